@@ -10,6 +10,8 @@
 #include "CfdMeshMgr.h"
 #include "Util.h"
 #include "SubSurfaceMgr.h"
+#include "ThreadPool.h"
+#include <chrono>
 #include "main.h"
 
 #ifdef DEBUG_CFD_MESH
@@ -357,6 +359,9 @@ CfdMeshMgrSingleton::CfdMeshMgrSingleton() : SurfaceIntersectionSingleton()
 
     m_MeshInProgress = false;
 
+    m_RemeshTime = 0.0;
+    m_RemeshPeakBytes = 0;
+
     m_MessageName = "CFDMessage";
 
 #ifdef DEBUG_CFD_MESH
@@ -962,10 +967,13 @@ void CfdMeshMgrSingleton::BuildTargetMap( int output_type )
     MSCloud ms_cloud;
     vector< MapSource* > allsources;
 
+    //==== Sources Are Updated, Bin Them Before The Threaded Map Build ====//
+    GetGridDensityPtr()->BuildSourceTree();
+
     int i;
     for ( i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
     {
-        m_SurfVec[i]->BuildTargetMap( allsources, i );
+        m_SurfVec[i]->BuildTargetMap( allsources, i, GetNumThreads() );
         m_SurfVec[i]->LimitTargetMap();
     }
 
@@ -1059,52 +1067,98 @@ void CfdMeshMgrSingleton::Remesh( int output_type )
     char str[256];
     int total_num_tris = 0;
     int nsurf = ( int )m_SurfVec.size();
+
+    //==== Surfaces only share border chains, which are fixed by now.  Remesh ====//
+    //==== them on a pool of threads, largest first so the long ones start early ====//
+    vector< pair< int, int > > size_index( nsurf );
     for ( int i = 0 ; i < nsurf ; ++i )
     {
-        int num_tris = 0;
+        size_index[i] = make_pair( -( int )m_SurfVec[i]->GetMesh()->GetTriList().size(), i );
+    }
+    sort( size_index.begin(), size_index.end() );
+
+    vector< int > order( nsurf );
+    for ( int i = 0 ; i < nsurf ; ++i )
+    {
+        order[i] = size_index[i].second;
+    }
+
+    vector< int > num_tris( nsurf, 0 );
+    vector< size_t > peak_bytes( nsurf, 0 );
+    ThreadPool pool( GetCfdSettingsPtr()->m_NumThreads );
 
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    pool.Run( order, [&]( int i )
+    {
+        char surf_str[256];
         int num_rev_removed = 0;
 
+        m_SurfVec[i]->GetMesh()->ResetPeakPoolBytes();
+
         for ( int iter = 0 ; iter < 10 ; ++iter )
         {
-            num_tris = 0;
             m_SurfVec[i]->GetMesh()->Remesh();
 
             num_rev_removed = m_SurfVec[i]->GetMesh()->RemoveRevTris();
 
+            num_tris[i] = m_SurfVec[i]->GetMesh()->GetTriList().size();
 
-            num_tris += m_SurfVec[i]->GetMesh()->GetTriList().size();
-
-            sprintf( str, "Surf %d/%d Iter %d/10 Num Tris = %d\n", i + 1, nsurf, iter + 1, num_tris );
+            sprintf( surf_str, "Surf %d/%d Iter %d/10 Num Tris = %d\n", i + 1, nsurf, iter + 1, num_tris[i] );
             if ( output_type != CfdMeshMgrSingleton::QUIET_OUTPUT )
             {
-                addOutputText( str, output_type );
+                addOutputText( surf_str, output_type );
             }
         }
-        total_num_tris += num_tris;
 
         if ( num_rev_removed > 0 )
         {
-            sprintf( str, "%d Reversed tris collapsed in final iteration.\n", num_rev_removed );
+            sprintf( surf_str, "%d Reversed tris collapsed in final iteration.\n", num_rev_removed );
             if ( output_type != CfdMeshMgrSingleton::QUIET_OUTPUT )
             {
-                addOutputText( str, output_type );
+                addOutputText( surf_str, output_type );
             }
         }
 
+        peak_bytes[i] = m_SurfVec[i]->GetMesh()->GetPeakPoolBytes();
+
         m_SurfVec[i]->GetMesh()->LoadSimpTris();
         m_SurfVec[i]->GetMesh()->Clear();
-        if ( GetSettingsPtr()->m_IntersectSubSurfs )
+    } );
+
+    m_RemeshTime = std::chrono::duration< double >( std::chrono::steady_clock::now() - start ).count();
+    m_RemeshPeakBytes = 0;
+    for ( int i = 0 ; i < nsurf ; ++i )
+    {
+        m_RemeshPeakBytes += peak_bytes[i];
+    }
+
+    //==== Subtag adds to the shared tag combos, keep it serial and in surface order ====//
+    if ( GetSettingsPtr()->m_IntersectSubSurfs )
+    {
+        for ( int i = 0 ; i < nsurf ; ++i )
         {
             Subtag( m_SurfVec[i] );
         }
+    }
+
+    pool.Run( order, [&]( int i )
+    {
         m_SurfVec[i]->GetMesh()->CondenseSimpTris();
+    } );
+
+    for ( int i = 0 ; i < nsurf ; ++i )
+    {
+        total_num_tris += num_tris[i];
     }
 
     m_WakeMgr.StretchWakes();
 
     sprintf( str, "Total Num Tris = %d\n", total_num_tris );
     addOutputText( str, output_type );
+
+    sprintf( str, "Remesh Time = %.3f sec, Peak Mesh Memory = %.1f MB\n", m_RemeshTime, m_RemeshPeakBytes / ( 1024.0 * 1024.0 ) );
+    addOutputText( str, output_type );
 }
 
 void CfdMeshMgrSingleton::RemeshSingleComp( int comp_id, int output_type )
@@ -2861,7 +2915,7 @@ void CfdMeshMgrSingleton::RemoveInteriorTris()
     for ( s = 0 ; s < ( int )m_SurfVec.size() ; ++s ) // every surface
     {
         int tri_comp_id = m_SurfVec[s]->GetCompID();
-        list <Tri*> triList = m_SurfVec[s]->GetMesh()->GetTriList();
+        list< Tri* > & triList = m_SurfVec[s]->GetMesh()->GetTriList();
         for ( t = triList.begin() ; t != triList.end(); ++t ) // every triangle
         {
             vector< vector< double > > t_vec_vec;
@@ -2962,7 +3016,7 @@ void CfdMeshMgrSingleton::RemoveInteriorTris()
     //==== Check Vote and Mark Interior Tris =====//
     for ( s = 0 ; s < ( int )m_SurfVec.size() ; ++s )
     {
-        list <Tri*> triList = m_SurfVec[s]->GetMesh()->GetTriList();
+        list< Tri* > & triList = m_SurfVec[s]->GetMesh()->GetTriList();
         for ( t = triList.begin() ; t != triList.end(); t++ )
         {
             for ( int i = 0 ; i < ( int )m_SurfVec.size() ; ++i )
@@ -2995,7 +3049,7 @@ void CfdMeshMgrSingleton::RemoveInteriorTris()
     for ( int a = 0 ; a < ( int )m_SurfVec.size() ; a++ )
     {
         int tri_comp_id = m_SurfVec[a]->GetCompID();
-        list< Tri * > triList = m_SurfVec[a]->GetMesh()->GetTriList();
+        list< Tri* > & triList = m_SurfVec[a]->GetMesh()->GetTriList();
         for ( t = triList.begin(); t != triList.end(); ++t )
         {
             // Determine if the triangle should be deleted
@@ -3010,7 +3064,7 @@ void CfdMeshMgrSingleton::RemoveInteriorTris()
         {
             if ( ! m_SurfVec[s]->GetSymPlaneFlag() )
             {
-                list <Tri*> triList = m_SurfVec[s]->GetMesh()->GetTriList();
+                list< Tri* > & triList = m_SurfVec[s]->GetMesh()->GetTriList();
                 for ( t = triList.begin() ; t != triList.end(); t++ )
                 {
                     vec3d cp = ( *t )->ComputeCenterPnt( m_SurfVec[s] );
@@ -3025,7 +3079,7 @@ void CfdMeshMgrSingleton::RemoveInteriorTris()
             {
                 if ( m_SurfVec[s]->GetSymPlaneFlag() )
                 {
-                    list <Tri*> triList = m_SurfVec[s]->GetMesh()->GetTriList();
+                    list< Tri* > & triList = m_SurfVec[s]->GetMesh()->GetTriList();
                     for ( t = triList.begin() ; t != triList.end(); t++ )
                     {
                         ( *t )->deleteFlag = true;
@@ -3051,7 +3105,7 @@ void CfdMeshMgrSingleton::ConnectBorderEdges( bool wakeOnly )
     {
         if ( m_SurfVec[s]->GetWakeFlag() == wakeOnly )
         {
-            list <Tri*> triList = m_SurfVec[s]->GetMesh()->GetTriList();
+            list< Tri* > & triList = m_SurfVec[s]->GetMesh()->GetTriList();
             for ( t = triList.begin() ; t != triList.end(); t++ )
             {
                 if ( ( *t )->e0->OtherTri( ( *t ) ) == NULL )
@@ -185,6 +185,10 @@ public:
     {
         return (SimpleMeshCommonSettings* ) &m_CfdSettings;
     }
+    int GetNumThreads() override
+    {
+        return m_CfdSettings.m_NumThreads;
+    }
 
     virtual void GenerateMesh();
 
@@ -260,6 +264,16 @@ public:
     virtual void Remesh( int output_type );
     virtual void RemeshSingleComp( int comp_id, int output_type );
 
+    //==== Wall Time And Peak Node/Edge/Tri Pool Memory Of The Last Remesh ====//
+    double GetRemeshTime()
+    {
+        return m_RemeshTime;
+    }
+    size_t GetRemeshPeakBytes()
+    {
+        return m_RemeshPeakBytes;
+    }
+
     virtual void InitMesh();
 
     virtual string GetQualString();
@@ -331,6 +345,9 @@ protected:
     vector<Tri*> m_BadTris;
     vector< Node* > m_nodeStore;
 
+    double m_RemeshTime;
+    size_t m_RemeshPeakBytes;
+
 private:
     DrawObj m_MeshBadEdgeDO;
     DrawObj m_MeshBadTriDO;
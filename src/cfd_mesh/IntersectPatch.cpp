@@ -14,7 +14,7 @@
 
 #include "eli/geom/intersect/intersect_surface.hpp"
 
-void intersect( const SurfPatch& bp1, const SurfPatch& bp2, SurfaceIntersectionSingleton *MeshMgr )
+void intersect( const SurfPatch& bp1, const SurfPatch& bp2, vector< PatchISeg > & segs )
 {
     int MAX_SUB = 12;
     int MIN_SUB = 3;
@@ -43,7 +43,7 @@ void intersect( const SurfPatch& bp1, const SurfPatch& bp2, SurfaceIntersectionS
     if ( ( planar1 || bp1.GetSubDepth() > MAX_SUB ) &&
          ( planar2 || bp2.GetSubDepth() > MAX_SUB ) )
     {
-        intersect_quads( bp1, bp2, MeshMgr );          // Plane - Plane Intersection
+        intersect_quads( bp1, bp2, segs );          // Plane - Plane Intersection
     }
     else
     {
@@ -71,10 +71,10 @@ void intersect( const SurfPatch& bp1, const SurfPatch& bp2, SurfaceIntersectionS
 
             bp1.split_patch( bps0, bps1, bps2, bps3 );      // Split Patch1 and Keep Subdividing
 
-            intersect( bps0, bp2, MeshMgr );
-            intersect( bps1, bp2, MeshMgr );
-            intersect( bps2, bp2, MeshMgr );
-            intersect( bps3, bp2, MeshMgr );
+            intersect( bps0, bp2, segs );
+            intersect( bps1, bp2, segs );
+            intersect( bps2, bp2, segs );
+            intersect( bps3, bp2, segs );
         }
         else
         {
@@ -89,15 +89,15 @@ void intersect( const SurfPatch& bp1, const SurfPatch& bp2, SurfaceIntersectionS
 
             bp2.split_patch( bps0, bps1, bps2, bps3 );      // Split Patch2 and Keep Subdividing
 
-            intersect( bp1, bps0, MeshMgr );
-            intersect( bp1, bps1, MeshMgr );
-            intersect( bp1, bps2, MeshMgr );
-            intersect( bp1, bps3, MeshMgr );
+            intersect( bp1, bps0, segs );
+            intersect( bp1, bps1, segs );
+            intersect( bp1, bps2, segs );
+            intersect( bp1, bps3, segs );
         }
     }
 }
 
-void intersect_quads( const SurfPatch& pa, const SurfPatch& pb, SurfaceIntersectionSingleton *MeshMgr )
+void intersect_quads( const SurfPatch& pa, const SurfPatch& pb, vector< PatchISeg > & segs )
 {
     int iflag;
     int coplanar;
@@ -120,31 +120,111 @@ void intersect_quads( const SurfPatch& pa, const SurfPatch& pb, SurfaceIntersect
     iflag = tri_tri_intersect_with_isectline( a0.v, a2.v, a3.v, b0.v, b2.v, b3.v, &coplanar, ip0.v, ip1.v );
     if ( iflag && !coplanar )
     {
-        MeshMgr->AddIntersectionSeg( pa, pb, ip0, ip1 );
+        add_intersect_seg( pa, pb, ip0, ip1, segs );
     }
 
     //==== Tri A1 and B2 ====//
     iflag = tri_tri_intersect_with_isectline( a0.v, a2.v, a3.v, b0.v, b1.v, b2.v, &coplanar, ip0.v, ip1.v );
     if ( iflag && !coplanar )
     {
-        MeshMgr->AddIntersectionSeg( pa, pb, ip0, ip1 );
+        add_intersect_seg( pa, pb, ip0, ip1, segs );
     }
 
     //==== Tri A2 and B1 ====//
     iflag = tri_tri_intersect_with_isectline( a0.v, a1.v, a2.v, b0.v, b2.v, b3.v, &coplanar, ip0.v, ip1.v );
     if ( iflag && !coplanar )
     {
-        MeshMgr->AddIntersectionSeg( pa, pb,  ip0, ip1 );
+        add_intersect_seg( pa, pb,  ip0, ip1, segs );
     }
 
     //==== Tri A2 and B2 ====//
     iflag = tri_tri_intersect_with_isectline( a0.v, a1.v, a2.v, b0.v, b1.v, b2.v, &coplanar, ip0.v, ip1.v );
     if ( iflag && !coplanar )
     {
-        MeshMgr->AddIntersectionSeg( pa, pb, ip0, ip1 );
+        add_intersect_seg( pa, pb, ip0, ip1, segs );
     }
 }
 
+//==== Project Segment Onto Both Patches - Keep It Unless It Is Degenerate Or Lies On A Shared Patch Edge ====//
+void add_intersect_seg( const SurfPatch& pA, const SurfPatch& pB, const vec3d & ip0, const vec3d & ip1, vector< PatchISeg > & segs )
+{
+    double d = dist_squared( ip0, ip1 );
+    if ( d < DBL_EPSILON )
+    {
+        return;
+    }
+
+    vec2d proj_uwA0;
+    pA.find_closest_uw( ip0, proj_uwA0.v );
+
+    vec2d proj_uwB0;
+    pB.find_closest_uw( ip0, proj_uwB0.v );
+
+    vec2d proj_uwA1;
+    pA.find_closest_uw( ip1, proj_uwA1.v );
+
+    vec2d proj_uwB1;
+    pB.find_closest_uw( ip1, proj_uwB1.v );
+
+    // Intersections that lie exactly on a patch boundary will actually intersect both patches
+    // that share that boundary.  So, detect intersections that lie on the patch minimum edge
+    // and don't carry those forward.  Don't do this if the minimum parameter is zero.  I.e.
+    // there is no prior patch.
+
+    double tol = 1e-8; // Tolerance buildup due to SurfPatch::find_closest_uw and other inaccuracies
+
+    if ( pA.get_u_min() > 0.0 ) // if Patch A is not the very beginning of u
+    {
+        double lim = pA.get_u_min() + tol;
+        // if both points projected to A are on the starting edge of u
+        if ( proj_uwA0.v[0] <= lim && proj_uwA1.v[0] <= lim )
+        {
+            return;
+        }
+    }
+
+    if ( pB.get_u_min() > 0.0 ) // if Patch B is not the very beginning of u
+    {
+        double lim = pB.get_u_min() + tol;
+        // if both points projected to B are on the starting edge of u
+        if ( proj_uwB0.v[0] <= lim && proj_uwB1.v[0] <= lim )
+        {
+            return;
+        }
+    }
+
+    if ( pA.get_w_min() > 0.0 ) // if Patch A is not the very beginning of w
+    {
+        double lim = pA.get_w_min() + tol;
+        // if both points projected to A are on the starting edge of w
+        if ( proj_uwA0.v[1] <= lim && proj_uwA1.v[1] <= lim )
+        {
+            return;
+        }
+    }
+
+    if ( pB.get_w_min() > 0.0 ) // if Patch B is not the very beginning of w
+    {
+        double lim = pB.get_w_min() + tol;
+        // if both points projected to B are on the starting edge of w
+        if ( proj_uwB0.v[1] <= lim && proj_uwB1.v[1] <= lim )
+        {
+            return;
+        }
+    }
+
+    PatchISeg seg;
+    seg.m_SurfA = pA.get_surf_ptr();
+    seg.m_SurfB = pB.get_surf_ptr();
+    seg.m_UWA[0] = proj_uwA0;
+    seg.m_UWA[1] = proj_uwA1;
+    seg.m_UWB[0] = proj_uwB0;
+    seg.m_UWB[1] = proj_uwB1;
+    seg.m_Pnt[0] = ip0;
+    seg.m_Pnt[1] = ip1;
+    segs.push_back( seg );
+}
+
 void refine_intersect_pt( const vec3d& pt, const SurfPatch &pA, double uwA[2], const SurfPatch &pB, double uwB[2] )
 {
 
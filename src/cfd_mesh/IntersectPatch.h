@@ -26,10 +26,23 @@ using namespace std;
 
 class SurfaceIntersectionSingleton;
 class CfdMeshMgrSingleton;
-
-//===== Intersect Two Bezier Patches  =====//
-void intersect( const SurfPatch& bp1, const SurfPatch& bp2, SurfaceIntersectionSingleton *MeshMgr );
-void intersect_quads( const SurfPatch& pa, const SurfPatch& pb, SurfaceIntersectionSingleton *MeshMgr );
+class Surf;
+
+//===== Intersection Segment Between Two Patches, Projected To Both Surfs =====//
+class PatchISeg
+{
+public:
+    Surf* m_SurfA;
+    Surf* m_SurfB;
+    vec2d m_UWA[2];
+    vec2d m_UWB[2];
+    vec3d m_Pnt[2];
+};
+
+//===== Intersect Two Bezier Patches - Only Reads The Patches, Segments Are Appended To segs  =====//
+void intersect( const SurfPatch& bp1, const SurfPatch& bp2, vector< PatchISeg > & segs );
+void intersect_quads( const SurfPatch& pa, const SurfPatch& pb, vector< PatchISeg > & segs );
+void add_intersect_seg( const SurfPatch& pa, const SurfPatch& pb, const vec3d & ip0, const vec3d & ip1, vector< PatchISeg > & segs );
 void refine_intersect_pt( const vec3d& pt, const SurfPatch &pA, double uwA[2], const SurfPatch &pB, double uwB[2] );
 double refine_intersect_pt( const vec3d& pt, Surf *sA, vec2d &uwA, Surf *sB, vec2d &uwB );
 
@@ -49,10 +49,12 @@ Mesh::~Mesh()
 
 void Mesh::Clear()
 {
+    DumpGarbage();
+
     list< Tri* >::iterator t;
     for ( t = triList.begin() ; t != triList.end(); t++ )
     {
-        delete ( *t );
+        m_TriPool.Free( *t );
     }
 
     triList.clear();
@@ -60,7 +62,7 @@ void Mesh::Clear()
     list< Edge* >::iterator e;
     for ( e = edgeList.begin() ; e != edgeList.end(); e++ )
     {
-        delete ( *e );
+        m_EdgePool.Free( *e );
     }
 
     edgeList.clear();
@@ -68,11 +70,16 @@ void Mesh::Clear()
     list< Node* >::iterator n;
     for ( n = nodeList.begin() ; n != nodeList.end(); n++ )
     {
-        delete ( *n );
+        m_NodePool.Free( *n );
     }
 
     nodeList.clear();
 
+    //==== Give The Slabs Back ====//
+    m_TriPool.Release();
+    m_EdgePool.Release();
+    m_NodePool.Release();
+
     m_NumFixPointIter = 0;
 }
 
@@ -517,7 +524,7 @@ void Mesh::ColorTris()
 
 Node* Mesh::AddNode( vec3d p, vec2d uw_in )
 {
-    Node* nptr = new Node( p, uw_in );
+    Node* nptr = m_NodePool.Alloc( p, uw_in );
     nodeList.push_back( nptr );
     nptr->list_ptr = --nodeList.end();
     return nptr;
@@ -546,7 +553,7 @@ Node* Mesh::FindNode( const vec3d& p )
 
 Edge* Mesh::AddEdge( Node* n0, Node* n1 )
 {
-    Edge* eptr = new Edge( n0, n1 );
+    Edge* eptr = m_EdgePool.Alloc( n0, n1 );
 
     edgeList.push_back( eptr );
     eptr->list_ptr = --edgeList.end();
@@ -592,7 +599,7 @@ Edge* Mesh::FindEdge( Node* n0, Node* n1 )
 
 Tri* Mesh::AddTri( Node* n0, Node* n1, Node* n2, Edge* e0, Edge* e1, Edge* e2 )
 {
-    Tri* tptr = new Tri( n0, n1, n2, e0, e1, e2 );
+    Tri* tptr = m_TriPool.Alloc( n0, n1, n2, e0, e1, e2 );
     triList.push_back( tptr );
     tptr->list_ptr = --triList.end();
     return tptr;
@@ -610,25 +617,43 @@ void Mesh::DumpGarbage()
     //==== Delete Flagged Nodes =====//
     for ( int i = 0 ; i < ( int )garbageNodeVec.size() ; i++ )
     {
-        delete garbageNodeVec[i];
+        m_NodePool.Free( garbageNodeVec[i] );
     }
     garbageNodeVec.clear();
 
     //==== Delete Flagged Edges =====//
     for ( int i = 0 ; i < ( int )garbageEdgeVec.size() ; i++ )
     {
-        delete garbageEdgeVec[i];
+        m_EdgePool.Free( garbageEdgeVec[i] );
     }
     garbageEdgeVec.clear();
 
     //==== Delete Flagged Tris =====//
     for ( int i = 0 ; i < ( int )garbageTriVec.size() ; i++ )
     {
-        delete garbageTriVec[i];
+        m_TriPool.Free( garbageTriVec[i] );
     }
     garbageTriVec.clear();
 }
 
+size_t Mesh::GetPoolBytes()
+{
+    return m_TriPool.GetNumBytes() + m_EdgePool.GetNumBytes() + m_NodePool.GetNumBytes();
+}
+
+size_t Mesh::GetPeakPoolBytes()
+{
+    return m_TriPool.GetPeakUsed() * sizeof( Tri ) + m_EdgePool.GetPeakUsed() * sizeof( Edge ) +
+           m_NodePool.GetPeakUsed() * sizeof( Node );
+}
+
+void Mesh::ResetPeakPoolBytes()
+{
+    m_TriPool.ResetPeak();
+    m_EdgePool.ResetPeak();
+    m_NodePool.ResetPeak();
+}
+
 void Mesh::SetNodeFlags()
 {
     list< Node* >::iterator n;
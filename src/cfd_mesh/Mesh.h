@@ -14,6 +14,7 @@
 #include "Vec2d.h"
 #include "Vec3d.h"
 #include "Tri.h"
+#include "MeshPool.h"
 
 class Surf;
 class SimpleGridDensity;
@@ -140,7 +141,7 @@ public:
 
     void ColorTris();
 
-    list <Tri*> GetTriList()
+    list <Tri*>& GetTriList()
     {
         return triList;
     }
@@ -162,6 +163,11 @@ public:
 
     void RemoveInteriorTrisEdgesNodes();
 
+    //==== Node, Edge and Tri Pool Memory ====//
+    size_t GetPoolBytes();
+    size_t GetPeakPoolBytes();
+    void ResetPeakPoolBytes();
+
     int GetNumFixPointIter()
     {
         return m_NumFixPointIter;
@@ -184,6 +190,10 @@ protected:
     vector< Edge* > garbageEdgeVec;
     vector< Node* > garbageNodeVec;
 
+    MeshPool< Tri > m_TriPool;
+    MeshPool< Edge > m_EdgePool;
+    MeshPool< Node > m_NodePool;
+
     int m_HighlightNodeIndex;
     int m_HighlightEdgeIndex;
 
@@ -0,0 +1,142 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+//////////////////////////////////////////////////////////////////////
+// MeshPool.h - Slab Storage For Mesh Nodes, Edges and Tris
+//
+// Objects are built in place in fixed size slabs and addressed by a
+// stable integer handle ( slab * MESH_POOL_SLAB_SIZE + slot ).  Freed
+// handles go on a free list and are reused by the next Alloc, so the
+// split/collapse/swap churn of a remesh does not touch the heap.
+//
+// T must have an int m_PoolIndex member, which is set to the handle.
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(MESH_POOL__INCLUDED_)
+#define MESH_POOL__INCLUDED_
+
+#include <vector>
+#include <new>
+#include <utility>
+#include <assert.h>
+using namespace std;
+
+#define MESH_POOL_SLAB_SIZE 4096
+
+template < class T >
+class MeshPool
+{
+public:
+
+    MeshPool()
+    {
+        m_NumSlots = 0;
+        m_NumUsed = 0;
+        m_PeakUsed = 0;
+    }
+    virtual ~MeshPool()
+    {
+        Release();
+    }
+
+    //==== Build Object In A Free Slot ====//
+    template < class... Args >
+    T* Alloc( Args&&... args )
+    {
+        int handle;
+        if ( m_FreeVec.size() )
+        {
+            handle = m_FreeVec.back();
+            m_FreeVec.pop_back();
+        }
+        else
+        {
+            if ( m_NumSlots == ( int )m_SlabVec.size() * MESH_POOL_SLAB_SIZE )
+            {
+                m_SlabVec.push_back( static_cast< T* >( ::operator new( sizeof( T ) * MESH_POOL_SLAB_SIZE ) ) );
+            }
+            handle = m_NumSlots++;
+        }
+
+        T* ptr = new ( Slot( handle ) ) T( std::forward< Args >( args )... );
+        ptr->m_PoolIndex = handle;
+
+        m_NumUsed++;
+        if ( m_NumUsed > m_PeakUsed )
+        {
+            m_PeakUsed = m_NumUsed;
+        }
+        return ptr;
+    }
+
+    //==== Destroy Object And Return Its Slot To The Free List ====//
+    void Free( T* ptr )
+    {
+        int handle = ptr->m_PoolIndex;
+        assert( handle >= 0 && handle < m_NumSlots && Slot( handle ) == ptr );
+
+        ptr->~T();
+        m_FreeVec.push_back( handle );
+        m_NumUsed--;
+    }
+
+    T* Get( int handle )
+    {
+        return Slot( handle );
+    }
+
+    //==== Drop All Slabs - Every Object Must Have Been Freed ====//
+    void Release()
+    {
+        assert( m_NumUsed == 0 );
+        for ( int i = 0 ; i < ( int )m_SlabVec.size() ; i++ )
+        {
+            ::operator delete( m_SlabVec[i] );
+        }
+        m_SlabVec.clear();
+        m_FreeVec.clear();
+        m_NumSlots = 0;
+    }
+
+    int GetNumUsed()
+    {
+        return m_NumUsed;
+    }
+    int GetPeakUsed()
+    {
+        return m_PeakUsed;
+    }
+    void ResetPeak()
+    {
+        m_PeakUsed = m_NumUsed;
+    }
+
+    //==== Bytes Held In Slabs ====//
+    size_t GetNumBytes()
+    {
+        return m_SlabVec.size() * MESH_POOL_SLAB_SIZE * sizeof( T );
+    }
+
+protected:
+
+    T* Slot( int handle )
+    {
+        return m_SlabVec[ handle / MESH_POOL_SLAB_SIZE ] + handle % MESH_POOL_SLAB_SIZE;
+    }
+
+    vector< T* > m_SlabVec;
+    vector< int > m_FreeVec;
+
+    int m_NumSlots;
+    int m_NumUsed;
+    int m_PeakUsed;
+
+private:
+
+    MeshPool( const MeshPool& );
+    MeshPool& operator=( const MeshPool& );
+};
+
+#endif
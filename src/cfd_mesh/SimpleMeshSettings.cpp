@@ -109,7 +109,7 @@ bool SimpleIntersectSettings::GetExportFileFlag( int type )
 
 SimpleCfdMeshSettings::SimpleCfdMeshSettings()
 {
-
+    m_NumThreads = 0;
 }
 
 SimpleCfdMeshSettings::~SimpleCfdMeshSettings()
@@ -145,6 +145,8 @@ void SimpleCfdMeshSettings::CopyFrom( CfdMeshSettings* settings )
     m_DrawSymmFlag = settings->m_DrawSymmFlag.Get();
     m_DrawWakeFlag = settings->m_DrawWakeFlag.Get();
 
+    m_NumThreads = settings->m_NumThreads.Get();
+
     m_SelectedSetIndex = settings->m_SelectedSetIndex.Get();
 
     m_ExportFileFlags.clear();
@@ -237,7 +239,7 @@ bool SimpleFeaMeshSettings::GetExportFileFlag( int type )
 
 SimpleGridDensity::SimpleGridDensity()
 {
-
+    m_SourceTreeValid = false;
 }
 
 SimpleGridDensity::~SimpleGridDensity()
@@ -257,6 +259,7 @@ void SimpleGridDensity::CopyFrom( GridDensity* gd )
     m_FarMaxGap = gd->m_FarMaxGap.Get();
     m_GrowRatio = gd->m_GrowRatio.Get();
     m_Sources = gd->GetSimpleSourceVec();
+    m_SourceTreeValid = false;
 }
 
 double SimpleGridDensity::GetRadFrac( bool farflag )
@@ -313,17 +316,156 @@ double SimpleGridDensity::GetTargetLen( vec3d& pos, bool farFlag, const string &
     }
     base_len = target_len;
 
-    for ( int i = 0; i < (int)m_Sources.size(); i++ )
+    if ( !m_SourceTreeValid )
     {
-        double len = m_Sources[i]->GetTargetLen( base_len, pos, geomid, surfindx, u, w );
+        for ( int i = 0; i < (int)m_Sources.size(); i++ )
+        {
+            double len = m_Sources[i]->GetTargetLen( base_len, pos, geomid, surfindx, u, w );
+            if ( len < target_len )
+            {
+                target_len = len;
+            }
+        }
+        return target_len;
+    }
+
+    for ( int i = 0; i < (int)m_UnboundSources.size(); i++ )
+    {
+        double len = m_Sources[ m_UnboundSources[i] ]->GetTargetLen( base_len, pos, geomid, surfindx, u, w );
         if ( len < target_len )
         {
             target_len = len;
         }
     }
+
+    //==== Only Sources Whose Influence Box Holds pos ====//
+    if ( m_SourceTree.size() )
+    {
+        int stack[64];
+        int nstack = 0;
+        stack[ nstack++ ] = 0;
+
+        while ( nstack > 0 )
+        {
+            const SourceTreeNode & node = m_SourceTree[ stack[ --nstack ] ];
+
+            if ( !node.m_Box.CheckPnt( pos ) )
+            {
+                continue;
+            }
+
+            if ( node.m_Count == 0 )
+            {
+                stack[ nstack++ ] = node.m_Index;
+                stack[ nstack++ ] = node.m_Index + 1;
+            }
+            else
+            {
+                for ( int i = node.m_Index; i < node.m_Index + node.m_Count; i++ )
+                {
+                    double len = m_Sources[ m_SourceOrder[i] ]->GetTargetLen( base_len, pos, geomid, surfindx, u, w );
+                    if ( len < target_len )
+                    {
+                        target_len = len;
+                    }
+                }
+            }
+        }
+    }
     return target_len;
 }
 
+#define SOURCE_TREE_MAX_LEAF 4
+
+void SimpleGridDensity::BuildSourceTree()
+{
+    m_SourceTree.clear();
+    m_SourceOrder.clear();
+    m_UnboundSources.clear();
+
+    vector< BndBox > box_vec;
+    for ( int i = 0; i < (int)m_Sources.size(); i++ )
+    {
+        BndBox box;
+        if ( m_Sources[i]->GetInfluenceBox( box ) )
+        {
+            m_SourceOrder.push_back( i );
+            box_vec.push_back( box );
+        }
+        else
+        {
+            m_UnboundSources.push_back( i );
+        }
+    }
+
+    if ( m_SourceOrder.size() )
+    {
+        m_SourceTree.reserve( 2 * m_SourceOrder.size() );
+        m_SourceTree.resize( 1 );
+        BuildSourceTreeNode( 0, box_vec, 0, ( int )m_SourceOrder.size() );
+    }
+
+    m_SourceTreeValid = true;
+}
+
+//==== Split At The Median Center Of The Longest Axis ====//
+void SimpleGridDensity::BuildSourceTreeNode( int inode, vector< BndBox > & box_vec, int begin, int end )
+{
+    BndBox box;
+    for ( int i = begin; i < end; i++ )
+    {
+        box.Update( box_vec[i] );
+    }
+    m_SourceTree[inode].m_Box = box;
+
+    if ( end - begin <= SOURCE_TREE_MAX_LEAF )
+    {
+        m_SourceTree[inode].m_Index = begin;
+        m_SourceTree[inode].m_Count = end - begin;
+        return;
+    }
+
+    int axis = 0;
+    for ( int k = 1; k < 3; k++ )
+    {
+        if ( box.GetMax( k ) - box.GetMin( k ) > box.GetMax( axis ) - box.GetMin( axis ) )
+        {
+            axis = k;
+        }
+    }
+
+    //==== Sort Boxes And Source Indices Together By Center ====//
+    vector< pair< double, int > > center_vec( end - begin );
+    for ( int i = begin; i < end; i++ )
+    {
+        center_vec[ i - begin ] = make_pair( box_vec[i].GetCenter()[ axis ], i );
+    }
+    int mid = ( end - begin ) / 2;
+    nth_element( center_vec.begin(), center_vec.begin() + mid, center_vec.end() );
+
+    vector< BndBox > sub_box( end - begin );
+    vector< int > sub_order( end - begin );
+    for ( int i = 0; i < end - begin; i++ )
+    {
+        sub_box[i] = box_vec[ center_vec[i].second ];
+        sub_order[i] = m_SourceOrder[ center_vec[i].second ];
+    }
+    for ( int i = 0; i < end - begin; i++ )
+    {
+        box_vec[ begin + i ] = sub_box[i];
+        m_SourceOrder[ begin + i ] = sub_order[i];
+    }
+
+    //==== Children Are Adjacent ====//
+    int ichild = ( int )m_SourceTree.size();
+    m_SourceTree.resize( ichild + 2 );
+    m_SourceTree[inode].m_Index = ichild;
+    m_SourceTree[inode].m_Count = 0;
+
+    BuildSourceTreeNode( ichild, box_vec, begin, begin + mid );
+    BuildSourceTreeNode( ichild + 1, box_vec, begin + mid, end );
+}
+
 void SimpleGridDensity::ScaleAllSources( double scale )
 {
     for ( int i = 0; i < (int)m_Sources.size(); i++ )
@@ -112,6 +112,8 @@ public:
     bool m_DrawSymmFlag;
     bool m_DrawWakeFlag;
 
+    int m_NumThreads;
+
     vector < bool > m_ExportFileFlags;
 
 protected:
@@ -182,11 +184,17 @@ public:
     void ClearSources()
     {
         m_Sources.clear();    //Deleted in Geom
+        m_SourceTreeValid = false;
     }
     void AddSource( BaseSimpleSource* s )
     {
         m_Sources.push_back( s );
+        m_SourceTreeValid = false;
     }
+
+    // Bin the sources by influence box, call once sources are updated and
+    // before any parallel GetTargetLen calls
+    void BuildSourceTree();
     int  GetNumSources()
     {
         return m_Sources.size();
@@ -212,6 +220,23 @@ protected:
 
     vector< BaseSimpleSource* > m_Sources;
 
+    //==== Bounding Box Tree Over Source Influence Boxes ====//
+    // Interior node children are at m_Index and m_Index + 1, leaf sources are
+    // m_SourceOrder[ m_Index ] ... m_SourceOrder[ m_Index + m_Count - 1 ]
+    struct SourceTreeNode
+    {
+        BndBox m_Box;
+        int m_Index;
+        int m_Count;
+    };
+
+    void BuildSourceTreeNode( int inode, vector< BndBox > & box_vec, int begin, int end );
+
+    bool m_SourceTreeValid;
+    vector< SourceTreeNode > m_SourceTree;
+    vector< int > m_SourceOrder;
+    vector< int > m_UnboundSources;        // No Influence Box - Always Evaluated
+
 };
 
 class SimpleCfdGridDensity : public SimpleGridDensity
@@ -15,6 +15,7 @@
 #include "CfdMeshMgr.h"
 #include "StlHelper.h"
 #include "SubSurfaceMgr.h"
+#include "ThreadPool.h"
 
 Surf::Surf()
 {
@@ -125,7 +126,7 @@ double Surf::TargetLen( double u, double w, double gap, double radfrac )
     return len;
 }
 
-void Surf::BuildTargetMap( vector< MapSource* > &sources, int sid )
+void Surf::BuildTargetMap( vector< MapSource* > &sources, int sid, int num_threads )
 {
     int npatchu = m_SurfCore.GetNumUPatches();
     int npatchw = m_SurfCore.GetNumWPatches();
@@ -155,8 +156,10 @@ void Surf::BuildTargetMap( vector< MapSource* > &sources, int sid )
         limitFlag = true;
     }
 
-    // Loop over surface evaluating source strength and curvature
-    for( int i = 0; i < nmapu ; i++ )
+    // Loop over surface evaluating source strength and curvature, each map
+    // point is independent so rows are spread over a pool of threads
+    ThreadPool pool( nmapu > 1 ? num_threads : 1 );
+    pool.Run( nmapu, [&]( int i )
     {
         double u = umin + du * ( 1.0 * i ) / ( nmapu - 1 );
         for( int j = 0; j < nmapw ; j++ )
@@ -185,8 +188,14 @@ void Surf::BuildTargetMap( vector< MapSource* > &sources, int sid )
             // finally check max size
             len = min( len, m_GridDensityPtr->GetBaseLen( limitFlag ) );
 
-            MapSource ms = MapSource( p, len, sid );
-            m_SrcMap[i][j] = ms;
+            m_SrcMap[i][j] = MapSource( p, len, sid );
+        }
+    } );
+
+    for( int i = 0; i < nmapu ; i++ )
+    {
+        for( int j = 0; j < nmapw ; j++ )
+        {
             sources.push_back( &( m_SrcMap[i][j] ) );
         }
     }
@@ -641,38 +650,75 @@ void Surf::WriteSTL( const char* filename )
 
 void Surf::Intersect( Surf* surfPtr, SurfaceIntersectionSingleton *MeshMgr )
 {
-    int i;
+    if ( !IntersectPrecheck( surfPtr, MeshMgr ) )
+    {
+        return;
+    }
+
+    vector< PatchISeg > segs;
+    IntersectPatches( surfPtr, segs );
+
+    for ( int i = 0 ; i < ( int )segs.size() ; i++ )
+    {
+        MeshMgr->AddIntersectionSeg( segs[i] );
+    }
+}
 
+//==== Check If Patches Need To Be Intersected - May Add Border Curve Segments To MeshMgr ====//
+bool Surf::IntersectPrecheck( Surf* surfPtr, SurfaceIntersectionSingleton *MeshMgr )
+{
     if ( surfPtr->GetCompID() == m_CompID )
     {
-        return;
+        return false;
     }
 
     if ( !Compare( m_BBox, surfPtr->GetBBox() ) )
     {
-        return;
+        return false;
     }
     if ( BorderCurveOnSurface( surfPtr, MeshMgr ) )
     {
-        return;
+        return false;
     }
     if ( surfPtr->BorderCurveOnSurface( this, MeshMgr ) )
     {
-        return;
+        return false;
     }
+    return true;
+}
 
-    vector< SurfPatch* > otherPatchVec = surfPtr->GetPatchVec();
+//==== Intersect Overlapping Patch Pairs - Only Reads Surfs So Pairs Can Run In Parallel ====//
+void Surf::IntersectPatches( Surf* surfPtr, vector< PatchISeg > & segs )
+{
+    int i;
+
+    //==== Patches That Touch The Other Surf ====//
+    vector< int > patch_ind;
+    vector< BndBox > patch_box;
     for ( i = 0 ; i < ( int )m_PatchVec.size() ; i++ )
+    {
         if ( Compare( *m_PatchVec[i]->get_bbox(), surfPtr->GetBBox() ) )
         {
-            for ( int j = 0 ; j < ( int )otherPatchVec.size() ; j++ )
-            {
-                if ( Compare( *m_PatchVec[i]->get_bbox(), *otherPatchVec[j]->get_bbox() ) )
-                {
-                    intersect( *m_PatchVec[i], *otherPatchVec[j], MeshMgr );
-                }
-            }
+            patch_ind.push_back( i );
+            patch_box.push_back( *m_PatchVec[i]->get_bbox() );
         }
+    }
+
+    const vector< SurfPatch* > & otherPatchVec = surfPtr->GetPatchVec();
+    vector< BndBox > other_box( otherPatchVec.size() );
+    for ( i = 0 ; i < ( int )otherPatchVec.size() ; i++ )
+    {
+        other_box[i] = *otherPatchVec[i]->get_bbox();
+    }
+
+    //==== Pairs Come Back In Patch Order ====//
+    vector< pair< int, int > > pairs;
+    OverlapPairs( patch_box, other_box, pairs );
+
+    for ( i = 0 ; i < ( int )pairs.size() ; i++ )
+    {
+        intersect( *m_PatchVec[ patch_ind[ pairs[i].first ] ], *otherPatchVec[ pairs[i].second ], segs );
+    }
 }
 
 void Surf::IntersectLineSeg( vec3d & p0, vec3d & p1, vector< double > & t_vals )
@@ -705,7 +751,7 @@ void Surf::IntersectLineSegMesh( vec3d & p0, vec3d & p1, vector< double > & t_va
 
     double tparm, uparm, vparm;
     list< Tri* >::iterator t;
-    list <Tri*> triList = m_Mesh.GetTriList();
+    list< Tri* > & triList = m_Mesh.GetTriList();
 
     vec3d dir = p1 - p0;
 
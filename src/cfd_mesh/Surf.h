@@ -17,6 +17,7 @@
 #include "Mesh.h"
 #include "SimpleMeshSettings.h"
 #include "SurfPatch.h"
+#include "IntersectPatch.h"
 #include "MapSource.h"
 #include "SurfCore.h"
 
@@ -60,7 +61,7 @@ public:
     }
 
     double TargetLen( double u, double w, double gap, double radfrac );
-    void BuildTargetMap( vector< MapSource* > &sources, int sid );
+    void BuildTargetMap( vector< MapSource* > &sources, int sid, int num_threads = 0 );
     void WalkMap( int istart, int jstart, int kstart );
     void WalkMap( int istart, int jstart );
     void LimitTargetMap();
@@ -153,6 +154,8 @@ public:
     }
 
     void Intersect( Surf* surfPtr, SurfaceIntersectionSingleton *MeshMgr );
+    bool IntersectPrecheck( Surf* surfPtr, SurfaceIntersectionSingleton *MeshMgr );
+    void IntersectPatches( Surf* surfPtr, vector< PatchISeg > & segs );
     void IntersectLineSeg( vec3d & p0, vec3d & p1, vector< double > & t_vals );
     void IntersectLineSegMesh( vec3d & p0, vec3d & p1, vector< double > & t_vals );
 
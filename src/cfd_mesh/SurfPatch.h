@@ -43,6 +43,7 @@ typedef piecewise_surface_type::tolerance_type surface_tolerance_type;
 class Surf;
 class SurfPatch;
 class SurfaceIntersectionSingleton;
+class PatchISeg;
 class CfdMeshMgrSingleton;
 
 //////////////////////////////////////////////////////////////////////
@@ -109,7 +110,7 @@ public:
     {
         return &bnd_box;
     }
-    friend void intersect( const SurfPatch& bp1, const SurfPatch& bp2, SurfaceIntersectionSingleton *MeshMgr );
+    friend void intersect( const SurfPatch& bp1, const SurfPatch& bp2, vector< PatchISeg > & segs );
     void find_closest_uw( const vec3d& pnt_in, double uw[2] ) const;
 
     friend void refine_intersect_pt( const vec3d& pt, const SurfPatch &pA, double uwA[2], const SurfPatch &pB, double uwB[2] );
@@ -133,7 +134,7 @@ public:
         return sub_depth;
     }
 
-    friend void intersect_quads( const SurfPatch&  bp1, const SurfPatch& bp2, SurfaceIntersectionSingleton *MeshMgr );
+    friend void intersect_quads( const SurfPatch&  bp1, const SurfPatch& bp2, vector< PatchISeg > & segs );
 
 protected:
 
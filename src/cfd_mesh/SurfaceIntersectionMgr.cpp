@@ -11,6 +11,7 @@
 #include "Util.h"
 #include "SubSurfaceMgr.h"
 #include "main.h"
+#include "ThreadPool.h"
 
 #include <chrono>
 
@@ -243,6 +244,7 @@ void SurfaceIntersectionSingleton::addOutputText( const string &str, int output_
 {
     if ( output_type != QUIET_OUTPUT )
     {
+        std::lock_guard< std::mutex > lock( m_OutputMutex );
 
         MessageData data;
         data.m_String = m_MessageName;
@@ -782,12 +784,41 @@ void SurfaceIntersectionSingleton::Intersect()
 
     if ( GetSettingsPtr()->m_IntersectSubSurfs ) BuildSubSurfIntChains();
 
-    //==== Quad Tree Intersection - Intersection Segments Get Loaded at AddIntersectionSeg ===//
+    //==== Broad Phase - Sweep and Prune Surf Bounding Boxes ====//
+    vector< BndBox > surf_box( m_SurfVec.size() );
     for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
     {
-        for ( int j = i + 1; j < (int) m_SurfVec.size(); j++ )
+        surf_box[i] = m_SurfVec[i]->GetBBox();
+    }
+
+    vector< pair< int, int > > cand_pairs;
+    OverlapPairs( surf_box, cand_pairs );
+
+    //==== Border Curve Checks May Add Segments - Keep Them Serial and In Surf Order ====//
+    vector< pair< int, int > > surf_pairs;
+    for ( int p = 0 ; p < ( int )cand_pairs.size() ; p++ )
+    {
+        if ( m_SurfVec[ cand_pairs[p].first ]->IntersectPrecheck( m_SurfVec[ cand_pairs[p].second ], this ) )
+        {
+            surf_pairs.push_back( cand_pairs[p] );
+        }
+    }
+
+    //==== Narrow Phase - Quad Tree Intersection of Each Surf Pair In Parallel ====//
+    vector< vector< PatchISeg > > pair_segs( surf_pairs.size() );
+
+    ThreadPool pool( GetNumThreads() );
+    pool.Run( ( int )surf_pairs.size(), [&]( int p )
+    {
+        m_SurfVec[ surf_pairs[p].first ]->IntersectPatches( m_SurfVec[ surf_pairs[p].second ], pair_segs[p] );
+    } );
+
+    //==== Intersection Segments Get Loaded at AddIntersectionSeg In Surf Pair Order ====//
+    for ( int p = 0 ; p < ( int )pair_segs.size() ; p++ )
+    {
+        for ( int k = 0 ; k < ( int )pair_segs[p].size() ; k++ )
         {
-            m_SurfVec[i]->Intersect( m_SurfVec[j], this );
+            AddIntersectionSeg( pair_segs[p][k] );
         }
     }
 
@@ -809,87 +840,25 @@ void SurfaceIntersectionSingleton::Intersect()
     BuildCurves();
 }
 
-void SurfaceIntersectionSingleton::AddIntersectionSeg( const SurfPatch& pA, const SurfPatch& pB, const vec3d & ip0, const vec3d & ip1 )
+void SurfaceIntersectionSingleton::AddIntersectionSeg( const PatchISeg & seg )
 {
-    double d = dist_squared( ip0, ip1 );
-    if ( d < DBL_EPSILON )
-    {
-        return;
-    }
-
-    vec2d proj_uwA0;
-    pA.find_closest_uw( ip0, proj_uwA0.v );
-
-    vec2d proj_uwB0;
-    pB.find_closest_uw( ip0, proj_uwB0.v );
-
-    vec2d proj_uwA1;
-    pA.find_closest_uw( ip1, proj_uwA1.v );
-
-    vec2d proj_uwB1;
-    pB.find_closest_uw( ip1, proj_uwB1.v );
-
-    // Intersections that lie exactly on a patch boundary will actually intersect both patches
-    // that share that boundary.  So, detect intersections that lie on the patch minimum edge
-    // and don't carry those forward.  Don't do this if the minimum parameter is zero.  I.e.
-    // there is no prior patch.
-
-    double tol = 1e-8; // Tolerance buildup due to SurfPatch::find_closest_uw and other inaccuracies
-
-    if ( pA.get_u_min() > 0.0 ) // if Patch A is not the very beginning of u
-    {
-        double lim = pA.get_u_min() + tol;
-        // if both points projected to A are on the starting edge of u
-        if ( proj_uwA0.v[0] <= lim && proj_uwA1.v[0] <= lim )
-        {
-            return;
-        }
-    }
-
-    if ( pB.get_u_min() > 0.0 ) // if Patch B is not the very beginning of u
-    {
-        double lim = pB.get_u_min() + tol;
-        // if both points projected to B are on the starting edge of u
-        if ( proj_uwB0.v[0] <= lim && proj_uwB1.v[0] <= lim )
-        {
-            return;
-        }
-    }
-
-    if ( pA.get_w_min() > 0.0 ) // if Patch A is not the very beginning of w
-    {
-        double lim = pA.get_w_min() + tol;
-        // if both points projected to A are on the starting edge of w
-        if ( proj_uwA0.v[1] <= lim && proj_uwA1.v[1] <= lim )
-        {
-            return;
-        }
-    }
-
-    if ( pB.get_w_min() > 0.0 ) // if Patch B is not the very beginning of w
-    {
-        double lim = pB.get_w_min() + tol;
-        // if both points projected to B are on the starting edge of w
-        if ( proj_uwB0.v[1] <= lim && proj_uwB1.v[1] <= lim )
-        {
-            return;
-        }
-    }
+    const vec3d & ip0 = seg.m_Pnt[0];
+    const vec3d & ip1 = seg.m_Pnt[1];
 
-    Puw* puwA0 = new Puw( pA.get_surf_ptr(), proj_uwA0 );
+    Puw* puwA0 = new Puw( seg.m_SurfA, seg.m_UWA[0] );
     m_DelPuwVec.push_back( puwA0 );
 
-    Puw* puwB0 = new Puw( pB.get_surf_ptr(), proj_uwB0 );
+    Puw* puwB0 = new Puw( seg.m_SurfB, seg.m_UWB[0] );
     m_DelPuwVec.push_back( puwB0 );
 
     IPnt* ipnt0 = new IPnt( puwA0, puwB0 );
     ipnt0->m_Pnt = ip0;
     m_DelIPntVec.push_back( ipnt0 );
 
-    Puw* puwA1 = new Puw( pA.get_surf_ptr(), proj_uwA1 );
+    Puw* puwA1 = new Puw( seg.m_SurfA, seg.m_UWA[1] );
     m_DelPuwVec.push_back( puwA1 );
 
-    Puw* puwB1 = new Puw( pB.get_surf_ptr(), proj_uwB1 );
+    Puw* puwB1 = new Puw( seg.m_SurfB, seg.m_UWB[1] );
     m_DelPuwVec.push_back( puwB1 );
 
     IPnt* ipnt1 = new IPnt( puwA1, puwB1 );
@@ -929,7 +898,7 @@ void SurfaceIntersectionSingleton::AddIntersectionSeg( const SurfPatch& pA, cons
 
     if ( !match )
     {
-        new ISeg( pA.get_surf_ptr(), pB.get_surf_ptr(), ipnt0, ipnt1 );
+        new ISeg( seg.m_SurfA, seg.m_SurfB, ipnt0, ipnt1 );
 
         m_BinMap[id0].m_ID = id0;
         m_BinMap[id0].m_IPnts.push_back( ipnt0 );
@@ -78,6 +78,7 @@
 #include <vector>
 #include <list>
 #include <string>
+#include <mutex>
 using namespace std;
 
 
@@ -137,7 +138,7 @@ public:
     virtual void Intersect();
 
 //  virtual void AddISeg( Surf* sA, Surf* sB, vec2d & sAuw0, vec2d & sAuw1,  vec2d & sBuw0, vec2d & sBuw1 );
-    virtual void AddIntersectionSeg( const SurfPatch& pA, const SurfPatch& pB, const vec3d & ip0, const vec3d & ip1 );
+    virtual void AddIntersectionSeg( const PatchISeg & seg );
 //  virtual ISeg* CreateSurfaceSeg( Surf* sPtr, vec3d & p0, vec3d & p1, vec2d & uw0, vec2d & uw1 );
     virtual ISeg* CreateSurfaceSeg( Surf* surfA, vec2d & uwA0, vec2d & uwA1, Surf* surfB, vec2d & uwB0, vec2d & uwB1  );
 
@@ -207,6 +208,11 @@ public:
     {
         return (SimpleMeshCommonSettings* )&m_IntersectSettings;
     }
+    //==== Worker Threads For Surface Intersection, <= 0 Uses All Hardware Threads ====//
+    virtual int GetNumThreads()
+    {
+        return 0;
+    }
 
     bool GetMeshInProgress()
     {
@@ -257,6 +263,9 @@ protected:
 
     string m_MessageName; // Either "SurfIntersectMessage", "CFDMessage", or "FEAMessage"
 
+    // Serializes output text sent from worker threads
+    std::mutex m_OutputMutex;
+
 private:
 
     DrawObj m_IsectCurveDO;
@@ -443,6 +443,7 @@ bool Edge::BothAdjoiningTrisInterior()
 Tri::Tri()
 {
     m_DeleteMeFlag = false;
+    m_PoolIndex = -1;
     debugFlag = false;
     n0 = n1 = n2 = NULL;
     e0 = e1 = e2 = NULL;
@@ -452,6 +453,7 @@ Tri::Tri()
 Tri::Tri( Node* nn0, Node* nn1, Node* nn2, Edge* ee0, Edge* ee1, Edge* ee2 )
 {
     m_DeleteMeFlag = false;
+    m_PoolIndex = -1;
     debugFlag = false;
     SetNodesEdges( nn0, nn1, nn2, ee0, ee1, ee2 );
     deleteFlag = false;
@@ -36,16 +36,19 @@ public:
     Node()
     {
         fixed = m_DeleteMeFlag = false;
+        m_PoolIndex = -1;
     }
     Node( vec3d& p, vec2d& uw_in )
     {
         pnt = p;
         uw = uw_in;
         fixed = m_DeleteMeFlag = false;
+        m_PoolIndex = -1;
     }
     virtual ~Node();
 
     list< Node* >::iterator list_ptr;
+    int m_PoolIndex;                // Handle In Mesh Node Pool
 
     bool m_DeleteMeFlag;
 
@@ -83,6 +86,7 @@ public:
         n0 = n1 = NULL;
         t0 = t1 = NULL;
         ridge = border = debugFlag = m_DeleteMeFlag = false;
+        m_PoolIndex = -1;
     }
     Edge( Node* node0, Node* node1 )
     {
@@ -90,10 +94,12 @@ public:
         n1 = node1;
         t0 = t1 = NULL;
         ridge = border = debugFlag = m_DeleteMeFlag = false;
+        m_PoolIndex = -1;
     }
     virtual ~Edge()                         {}
 
     list< Edge* >::iterator list_ptr;
+    int m_PoolIndex;                // Handle In Mesh Edge Pool
 
     bool m_DeleteMeFlag;
 
@@ -150,6 +156,7 @@ public:
     virtual ~Tri();
 
     list< Tri* >::iterator list_ptr;
+    int m_PoolIndex;                // Handle In Mesh Tri Pool
     bool m_DeleteMeFlag;
 
     Node* n0;
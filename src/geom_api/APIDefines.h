@@ -228,6 +228,7 @@ enum COMPUTATION_FILE_TYPE  {   NO_FILE_TYPE        = 0,
                                 CFD_FACET_TYPE      = 1048576,
                                 CFD_CURV_TYPE       = 2097152,
                                 CFD_PLOT3D_TYPE     = 4194304,
+                                DEGEN_GEOM_BIN_TYPE = 8388608,
 };
 
 enum SET_TYPE { SET_ALL = 0,
@@ -291,6 +292,7 @@ enum CFD_CONTROL_TYPE {     CFD_MIN_EDGE_LEN,
                             CFD_WAKE_SCALE,
                             CFD_WAKE_ANGLE,
                             CFD_SRF_XYZ_FLAG,
+                            CFD_NUM_THREADS,
                       };
 
 enum CFD_MESH_SOURCE_TYPE { POINT_SOURCE,
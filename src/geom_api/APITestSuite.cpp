@@ -183,6 +183,82 @@ void APITestSuite::CopyPasteGeometry()
 
 }
 
+//==== Batch Surface Queries Must Match The Per Point Queries ====//
+void APITestSuite::CheckVecSurfQueries()
+{
+    printf( "APITestSuite::CheckVecSurfQueries()\n" );
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== Symmetric Wing, So Points Project To Either Surface ====//
+    string wing_id = vsp::AddGeom( "WING" );
+    vsp::SetParmVal( wing_id, "Sym_Planar_Flag", "Sym", vsp::SYM_XZ );
+    vsp::Update();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    int nsurf = vsp::GetNumMainSurfs( wing_id ) * 2;
+
+    vector< double > u_vec, w_vec;
+    for ( int i = 0 ; i < 9 ; i++ )
+    {
+        for ( int j = 0 ; j < 7 ; j++ )
+        {
+            u_vec.push_back( 0.1 + 0.1 * i );
+            w_vec.push_back( 0.05 + 0.13 * j );
+        }
+    }
+
+    //==== Points Just Off Each Surface ====//
+    vector< vec3d > pts;
+    for ( int s = 0 ; s < nsurf ; s++ )
+    {
+        vector< vec3d > pnt_vec = vsp::CompVecPnt01( wing_id, s, u_vec, w_vec );
+        vector< vec3d > norm_vec = vsp::CompVecNorm01( wing_id, s, u_vec, w_vec );
+        TEST_ASSERT( pnt_vec.size() == u_vec.size() );
+        TEST_ASSERT( norm_vec.size() == u_vec.size() );
+
+        for ( int i = 0 ; i < ( int )pnt_vec.size() ; i++ )
+        {
+            vec3d p = vsp::CompPnt01( wing_id, s, u_vec[i], w_vec[i] );
+            TEST_ASSERT_DELTA( dist( p, pnt_vec[i] ), 0.0, TEST_TOL );
+            pts.push_back( pnt_vec[i] + norm_vec[i] * 0.02 );
+        }
+    }
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    vector< int > surf_vec;
+    vector< double > up_vec, wp_vec, d_vec;
+    vsp::ProjVecPnt01I( wing_id, pts, surf_vec, up_vec, wp_vec, d_vec );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    TEST_ASSERT( surf_vec.size() == pts.size() );
+    TEST_ASSERT( up_vec.size() == pts.size() );
+    TEST_ASSERT( wp_vec.size() == pts.size() );
+    TEST_ASSERT( d_vec.size() == pts.size() );
+    if ( d_vec.size() != pts.size() )
+    {
+        return;
+    }
+
+    for ( int i = 0 ; i < ( int )pts.size() ; i++ )
+    {
+        int surf;
+        double u, w;
+        double d = vsp::ProjPnt01I( wing_id, pts[i], surf, u, w );
+
+        TEST_ASSERT( surf_vec[i] == surf );
+        TEST_ASSERT_DELTA( up_vec[i], u, 1.0e-6 );
+        TEST_ASSERT_DELTA( wp_vec[i], w, 1.0e-6 );
+        TEST_ASSERT_DELTA( d_vec[i], d, 1.0e-6 );
+    }
+
+    //==== Bad Geom Reports Its Own Function ====//
+    vsp::ProjVecPnt01I( "NotAGeomID", pts, surf_vec, up_vec, wp_vec, d_vec );
+    TEST_ASSERT( surf_vec.size() == 0 );
+    TEST_ASSERT( vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+}
+
 // Test of analysis manager
 void APITestSuite::CheckAnalysisMgr()
 {
@@ -25,6 +25,7 @@ public:
         TEST_ADD( APITestSuite::CreateGeometry )
         TEST_ADD( APITestSuite::ChangePodParams )
         TEST_ADD( APITestSuite::CopyPasteGeometry )
+        TEST_ADD( APITestSuite::CheckVecSurfQueries )
         // Analysis
         TEST_ADD( APITestSuite::CheckAnalysisMgr )
         TEST_ADD( APITestSuite::TestAnalysesWithPod )
@@ -46,6 +47,7 @@ private:
     void CreateGeometry();
     void ChangePodParams();
     void CopyPasteGeometry();
+    void CheckVecSurfQueries();
     // Analysis
     void CheckAnalysisMgr();
     void TestAnalysesWithPod();
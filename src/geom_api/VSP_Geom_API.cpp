@@ -29,10 +29,15 @@
 #include "FeaStructure.h"
 #include "StructureMgr.h"
 #include "FeaMeshMgr.h"
+#include "SurfProjector.h"
+#include "ThreadPool.h"
+#include "DegenBinFile.h"
 
 #include "eli/mutil/quad/simpson.hpp"
 #include "Eigen/src/Core/Matrix.h"
 
+#define API_VEC_CHUNK 256       // Points Per Thread Pool Task In Vector Queries
+
 #ifdef VSP_USE_FLTK
 #include "GuiInterface.h"
 #endif
@@ -143,6 +148,23 @@ void Update()
     ErrorMgr.NoError();
 }
 
+/// Zero the Geom update counts and timing
+void ResetUpdateStats()
+{
+    Vehicle* veh = GetVehicle();
+    veh->ResetUpdateStats();
+    ErrorMgr.NoError();
+}
+
+/// Write Geom update counts and timing since the last reset to an Update_Stats result, return its ID
+string GetUpdateStats()
+{
+    Vehicle* veh = GetVehicle();
+    string id = veh->CreateUpdateStatsResults();
+    ErrorMgr.NoError();
+    return id;
+}
+
 
 void VSPExit( int error_code )
 {
@@ -459,11 +481,67 @@ void ComputeDegenGeom( int set, int file_export_types )
         veh->setExportDegenGeomCsvFile( true );
     }
 
+    veh->setExportDegenGeomBinFile( false );
+    if ( file_export_types & DEGEN_GEOM_BIN_TYPE )
+    {
+        veh->setExportDegenGeomBinFile( true );
+    }
+
     veh->CreateDegenGeom( set );
     veh->WriteDegenGeomFile();
     ErrorMgr.NoError();
 }
 
+/// Read a binary Degenerate Geometry file into the results manager
+string ReadDegenGeomBin( const string & file_name )
+{
+    DegenBinReader reader;
+    if ( !reader.Open( file_name ) )
+    {
+        ErrorMgr.AddError( VSP_FILE_READ_FAILURE, "ReadDegenGeomBin::Error reading " + file_name );
+        return string();
+    }
+
+    const vector< DegenBinChunk > & chunks = reader.GetChunks();
+
+    Results* res = ResultsMgr.CreateResults( "DegenGeomBin" );
+    vector< string > chunk_ids;
+
+    for ( int c = 0; c < ( int )chunks.size(); c++ )
+    {
+        const DegenBinChunk & chunk = chunks[c];
+
+        Results* chunk_res = ResultsMgr.CreateResults( "DegenGeomBin_Chunk" );
+        chunk_ids.push_back( chunk_res->GetID() );
+
+        chunk_res->Add( NameValData( "kind", chunk.m_Kind ) );
+
+        for ( int a = 0; a < ( int )chunk.m_AttrKeys.size(); a++ )
+        {
+            chunk_res->Add( NameValData( chunk.m_AttrKeys[a], chunk.m_AttrVals[a] ) );
+        }
+
+        vector< string > array_names;
+        for ( int a = 0; a < ( int )chunk.m_Arrays.size(); a++ )
+        {
+            const DegenBinArray & arr = chunk.m_Arrays[a];
+            array_names.push_back( arr.m_Name );
+
+            vector< int > dims( arr.m_Dims.begin(), arr.m_Dims.end() );
+            chunk_res->Add( NameValData( arr.m_Name, vector< double >( arr.m_Data, arr.m_Data + arr.m_Size ) ) );
+            chunk_res->Add( NameValData( arr.m_Name + "_dims", dims ) );
+            chunk_res->Add( NameValData( arr.m_Name + "_labels", arr.m_Labels ) );
+        }
+        chunk_res->Add( NameValData( "arrays", array_names ) );
+    }
+
+    res->Add( NameValData( "file_name", file_name ) );
+    res->Add( NameValData( "Chunks", chunk_ids ) );
+
+    ErrorMgr.NoError();
+    return res->GetID();
+}
+
 //==== Compute Plane Slice =====//
 string ComputePlaneSlice( int set, int num_slices, const vec3d & norm, bool auto_bnd, double start_bnd, double end_bnd )
 {
@@ -539,6 +617,8 @@ void SetCFDMeshVal( int type, double val )
         GetVehicle()->GetCfdSettingsPtr()->m_WakeAngle = val;
     else if ( type == CFD_SRF_XYZ_FLAG )
         GetVehicle()->GetCfdSettingsPtr()->m_XYZIntCurveFlag = ToBool(val);
+    else if ( type == CFD_NUM_THREADS )
+        GetVehicle()->GetCfdSettingsPtr()->m_NumThreads = ( int )val;
     else
     {
         ErrorMgr.AddError( VSP_CANT_FIND_TYPE, "SetCFDMeshVal::Can't Find Type " + to_string( ( long long )type ) );
@@ -2289,6 +2369,7 @@ void SetDriverGroup( const string & geom_id, int section_index, int driver_0, in
     ws->m_DriverGroup.SetChoice( 0, driver_0 );
     ws->m_DriverGroup.SetChoice( 1, driver_1 );
     ws->m_DriverGroup.SetChoice( 2, driver_2 );
+    ws->ParmChanged( NULL, Parm::SET ); // Mark Geom For Update
     ErrorMgr.NoError();
 }
 
@@ -2627,6 +2708,7 @@ vector<vec3d> ReadFileXSec( const string& xsec_id, const string& file_name )
         assert( file_xs );
         if ( file_xs->ReadXsecFile( file_name ) )
         {
+            xs->ParmChanged( NULL, Parm::SET ); // Mark Geom For Update
             ErrorMgr.NoError();
             return file_xs->GetUnityFilePnts();
         }
@@ -2659,6 +2741,7 @@ void SetXSecPnts( const string& xsec_id, vector< vec3d > & pnt_vec )
     FileXSec* file_xs = dynamic_cast<FileXSec*>( xs->GetXSecCurve() );
     assert( file_xs );
     file_xs->SetPnts( pnt_vec );
+    xs->ParmChanged( NULL, Parm::SET ); // Mark Geom For Update
     ErrorMgr.NoError();
 }
 
@@ -2830,6 +2913,7 @@ void ReadFileAirfoil( const string& xsec_id, const string& file_name )
         assert( file_xs );
         if( file_xs->ReadFile( file_name ) )
         {
+            xs->ParmChanged( NULL, Parm::SET ); // Mark Geom For Update
             ErrorMgr.NoError();
             return;
         }
@@ -2862,6 +2946,7 @@ void SetAirfoilPnts( const string& xsec_id, std::vector< vec3d > & up_pnt_vec, s
     FileAirfoil* file_xs = dynamic_cast<FileAirfoil*>( xs->GetXSecCurve() );
     assert( file_xs );
     file_xs->SetAirfoilPnts( up_pnt_vec, low_pnt_vec );
+    xs->ParmChanged( NULL, Parm::SET ); // Mark Geom For Update
     ErrorMgr.NoError();
 }
 
@@ -3525,6 +3610,7 @@ void SetUpperCST( const string& xsec_id, int deg, const std::vector<double> &coe
 
     ErrorMgr.NoError();
     cst_xs->SetUpperCST( deg, coefs );
+    xs->ParmChanged( NULL, Parm::SET ); // Mark Geom For Update
 }
 
 void SetLowerCST( const string& xsec_id, int deg, const std::vector<double> &coefs )
@@ -3547,6 +3633,7 @@ void SetLowerCST( const string& xsec_id, int deg, const std::vector<double> &coe
 
     ErrorMgr.NoError();
     cst_xs->SetLowerCST( deg, coefs );
+    xs->ParmChanged( NULL, Parm::SET ); // Mark Geom For Update
 }
 
 void PromoteCSTUpper( const string& xsec_id )
@@ -3569,6 +3656,7 @@ void PromoteCSTUpper( const string& xsec_id )
 
     ErrorMgr.NoError();
     cst_xs->PromoteUpper();
+    xs->ParmChanged( NULL, Parm::SET ); // Mark Geom For Update
 }
 
 void PromoteCSTLower( const string& xsec_id )
@@ -3591,6 +3679,7 @@ void PromoteCSTLower( const string& xsec_id )
 
     ErrorMgr.NoError();
     cst_xs->PromoteLower();
+    xs->ParmChanged( NULL, Parm::SET ); // Mark Geom For Update
 }
 
 void DemoteCSTUpper( const string& xsec_id )
@@ -3613,6 +3702,7 @@ void DemoteCSTUpper( const string& xsec_id )
 
     ErrorMgr.NoError();
     cst_xs->DemoteUpper();
+    xs->ParmChanged( NULL, Parm::SET ); // Mark Geom For Update
 }
 
 void DemoteCSTLower( const string& xsec_id )
@@ -3635,6 +3725,7 @@ void DemoteCSTLower( const string& xsec_id )
 
     ErrorMgr.NoError();
     cst_xs->DemoteLower();
+    xs->ParmChanged( NULL, Parm::SET ); // Mark Geom For Update
 }
 
 void FitAfCST( const string & xsec_surf_id, int xsec_index, int deg )
@@ -3702,6 +3793,7 @@ void FitAfCST( const string & xsec_surf_id, int xsec_index, int deg )
 
     assert( cst_xs );
     cst_xs->FitCurve( c, deg );
+    newxsec->ParmChanged( NULL, Parm::SET ); // Mark Geom For Update
 
     ErrorMgr.NoError();
 }
@@ -5225,10 +5317,18 @@ vector < vec3d > CompVecPnt01( const std::string &geom_id, const int &surf_indx,
             {
                 pts.resize( us.size() );
 
-                for ( int i = 0; i < us.size(); i++ )
+                int npts = ( int )us.size();
+                int num_chunks = ( npts + API_VEC_CHUNK - 1 ) / API_VEC_CHUNK;
+
+                ThreadPool pool( num_chunks > 1 ? 0 : 1 );
+                pool.Run( num_chunks, [&]( int c )
                 {
-                    pts[i] = surf->CompPnt01( clamp( us[i], 0.0, 1.0 ), clamp( ws[i], 0.0, 1.0 ) );
-                }
+                    int end = min( ( c + 1 ) * API_VEC_CHUNK, npts );
+                    for ( int i = c * API_VEC_CHUNK; i < end; i++ )
+                    {
+                        pts[i] = surf->CompPnt01( clamp( us[i], 0.0, 1.0 ), clamp( ws[i], 0.0, 1.0 ) );
+                    }
+                } );
             }
             else
             {
@@ -5361,14 +5461,10 @@ void ProjVecPnt01(const std::string &geom_id, const int &surf_indx, const vector
 
         if ( surf )
         {
-            us.resize( pts.size() );
-            ws.resize( pts.size() );
-            ds.resize( pts.size() );
+            vector < const VspSurf* > surf_vec( 1, surf );
+            vector < int > surf_indx_vec;
 
-            for ( int i = 0; i < pts.size(); i++ )
-            {
-                ds[i] = surf->FindNearest01( us[i], ws[i], pts[i] );
-            }
+            ProjectVecPnt01( surf_vec, pts, surf_indx_vec, us, ws, ds );
         }
         else
         {
@@ -5384,6 +5480,26 @@ void ProjVecPnt01(const std::string &geom_id, const int &surf_indx, const vector
     ErrorMgr.NoError();
 }
 
+void ProjVecPnt01I( const std::string &geom_id, const vector < vec3d > &pts, vector < int > &surf_indx_vec, vector < double > &us, vector < double > &ws, vector < double > &ds )
+{
+    Vehicle* veh = GetVehicle();
+
+    surf_indx_vec.resize( 0 );
+    us.resize( 0 );
+    ws.resize( 0 );
+    ds.resize( 0 );
+
+    if ( !veh->FindGeom( geom_id ) )
+    {
+        ErrorMgr.AddError( VSP_INVALID_GEOM_ID, "ProjVecPnt01I::Can't Find Geom " + geom_id );
+        return;
+    }
+
+    veh->ProjVecPnt01I( geom_id, pts, surf_indx_vec, us, ws, ds );
+
+    ErrorMgr.NoError();
+}
+
 void ProjVecPnt01Guess( const std::string &geom_id, const int &surf_indx, const vector < vec3d > &pts, const vector < double > &u0s, const vector < double > &w0s, vector < double > &us, vector < double > &ws, vector < double > &ds )
 {
     Vehicle* veh = GetVehicle();
@@ -5406,10 +5522,18 @@ void ProjVecPnt01Guess( const std::string &geom_id, const int &surf_indx, const
                 ws.resize( pts.size() );
                 ds.resize( pts.size() );
 
-                for ( int i = 0; i < pts.size(); i++ )
+                int npts = ( int )pts.size();
+                int num_chunks = ( npts + API_VEC_CHUNK - 1 ) / API_VEC_CHUNK;
+
+                ThreadPool pool( num_chunks > 1 ? 0 : 1 );
+                pool.Run( num_chunks, [&]( int c )
                 {
-                    ds[i] = surf->FindNearest01( us[i], ws[i], pts[i], clamp( u0s[i], 0.0, 1.0 ), clamp( w0s[i], 0.0, 1.0 ) );
-                }
+                    int end = min( ( c + 1 ) * API_VEC_CHUNK, npts );
+                    for ( int i = c * API_VEC_CHUNK; i < end; i++ )
+                    {
+                        ds[i] = surf->FindNearest01( us[i], ws[i], pts[i], clamp( u0s[i], 0.0, 1.0 ), clamp( w0s[i], 0.0, 1.0 ) );
+                    }
+                } );
             }
             else
             {
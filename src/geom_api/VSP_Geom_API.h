@@ -36,6 +36,9 @@ extern void VSPRenew();
 extern void Update();
 extern void VSPExit( int error_code );
 
+extern void ResetUpdateStats();
+extern std::string GetUpdateStats();
+
 //======================== File I/O ================================//
 extern void ReadVSPFile( const std::string & file_name );
 extern void WriteVSPFile( const std::string & file_name, int set = SET_ALL );
@@ -66,6 +69,7 @@ extern std::string ComputeCompGeom( int set, bool half_mesh, int file_export_typ
 extern std::string ComputePlaneSlice( int set, int num_slices, const vec3d & norm, bool auto_bnd,
                                  double start_bnd = 0, double end_bnd = 0 );
 extern void ComputeDegenGeom( int set, int file_export_types );
+extern std::string ReadDegenGeomBin( const std::string & file_name );
 extern void ComputeCFDMesh( int set, int file_export_types );
 extern void SetCFDMeshVal( int type, double val );
 extern void SetCFDWakeFlag( const std::string & geom_id, bool flag );
@@ -346,6 +350,7 @@ extern std::vector < vec3d > CompVecPnt01(const std::string &geom_id, const int
 extern std::vector < vec3d > CompVecNorm01(const std::string &geom_id, const int &surf_indx, const std::vector < double > &us, const std::vector < double > &ws);
 extern void CompVecCurvature01(const std::string &geom_id, const int &surf_indx, const std::vector < double > &us, const std::vector < double > &ws, std::vector < double > &k1_out_vec, std::vector < double > &k2_out_vec, std::vector < double > &ka_out_vec, std::vector < double > &kg_out_vec);
 extern void ProjVecPnt01(const std::string &geom_id, const int &surf_indx, const std::vector < vec3d > &pts, std::vector < double > &u_out_vec, std::vector < double > &w_out_vec, std::vector < double > &d_out_vec );
+extern void ProjVecPnt01I(const std::string &geom_id, const std::vector < vec3d > &pts, std::vector < int > &surf_indx_out_vec, std::vector < double > &u_out_vec, std::vector < double > &w_out_vec, std::vector < double > &d_out_vec );
 extern void ProjVecPnt01Guess(const std::string &geom_id, const int &surf_indx, const std::vector < vec3d > &pts, const std::vector < double > &u0s, const std::vector < double > &w0s, std::vector < double > &u_out_vec, std::vector < double > &w_out_vec, std::vector < double > &d_out_vec );
 
 extern void GetUWTess01(const std::string &geom_id, const int &surf_indx, std::vector < double > &u_out_vec, std::vector < double > &w_out_vec);
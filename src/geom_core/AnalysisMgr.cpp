@@ -620,6 +620,7 @@ void DegenGeomAnalysis::SetDefaults()
     {
         m_Inputs.Add( NameValData( "WriteCSVFlag", veh->getExportDegenGeomCsvFile() ) );
         m_Inputs.Add( NameValData( "WriteMFileFlag", veh->getExportDegenGeomMFile() ) );
+        m_Inputs.Add( NameValData( "WriteBinFlag", veh->getExportDegenGeomBinFile() ) );
     }
 }
 
@@ -633,8 +634,10 @@ string DegenGeomAnalysis::Execute()
         int set_num = vsp::SET_ALL;
         bool write_csv_orig = veh->getExportDegenGeomCsvFile();
         bool write_mfile_orig = veh->getExportDegenGeomMFile();
+        bool write_bin_orig = veh->getExportDegenGeomBinFile();
         bool write_csv = write_csv_orig;
         bool write_mfile = write_mfile_orig;
+        bool write_bin = write_bin_orig;
 
         NameValData *nvd;
         nvd = m_Inputs.FindPtr( "Set", 0 );
@@ -652,9 +655,15 @@ string DegenGeomAnalysis::Execute()
         {
             write_mfile = ( bool )nvd->GetInt( 0 );
         }
+        nvd = m_Inputs.FindPtr( "WriteBinFlag", 0 );
+        if ( nvd )
+        {
+            write_bin = ( bool )nvd->GetInt( 0 );
+        }
 
         veh->setExportDegenGeomCsvFile( write_csv );
         veh->setExportDegenGeomMFile( write_mfile );
+        veh->setExportDegenGeomBinFile( write_bin );
 
         veh->CreateDegenGeom( set_num );
         veh->WriteDegenGeomFile();
@@ -662,6 +671,7 @@ string DegenGeomAnalysis::Execute()
 
         veh->setExportDegenGeomCsvFile( write_csv_orig );
         veh->setExportDegenGeomMFile( write_mfile_orig );
+        veh->setExportDegenGeomBinFile( write_bin_orig );
 
         res = ResultsMgr.FindLatestResultsID( "DegenGeom" );
 
@@ -1551,6 +1561,7 @@ void VSPAEROSweepAnalysis::SetDefaults()
         m_Inputs.Add( NameValData( "GeomSet",            VSPAEROMgr.m_GeomSet.Get()            ) );
         m_Inputs.Add( NameValData( "AnalysisMethod",     VSPAEROMgr.m_AnalysisMethod.Get()     ) );
         m_Inputs.Add( NameValData( "NCPU",               VSPAEROMgr.m_NCPU.Get()               ) );
+        m_Inputs.Add( NameValData( "NumSweepWorkers",    VSPAEROMgr.m_NumSweepWorkers.Get()    ) );
         m_Inputs.Add( NameValData( "WakeNumIter",        VSPAEROMgr.m_WakeNumIter.Get()        ) );
         m_Inputs.Add( NameValData( "WakeAvgStartIter",   VSPAEROMgr.m_WakeAvgStartIter.Get()   ) );
         m_Inputs.Add( NameValData( "WakeSkipUntilIter",  VSPAEROMgr.m_WakeSkipUntilIter.Get()  ) );
@@ -1773,6 +1784,7 @@ string VSPAEROSweepAnalysis::Execute()
 
         //Case Setup
         int ncpuOrig                 = VSPAEROMgr.m_NCPU.Get();
+        int numSweepWorkersOrig      = VSPAEROMgr.m_NumSweepWorkers.Get();
         int wakeNumIterOrig          = VSPAEROMgr.m_WakeNumIter.Get();
         int wakeAvgStartIterOrig     = VSPAEROMgr.m_WakeAvgStartIter.Get();
         int wakeSkipUntilIterOrig    = VSPAEROMgr.m_WakeSkipUntilIter.Get();
@@ -1790,6 +1802,11 @@ string VSPAEROSweepAnalysis::Execute()
         {
             VSPAEROMgr.m_NCPU.Set( nvd->GetInt(0) );
         }
+        nvd = m_Inputs.FindPtr( "NumSweepWorkers", 0 );
+        if ( nvd )
+        {
+            VSPAEROMgr.m_NumSweepWorkers.Set( nvd->GetInt(0) );
+        }
         nvd = m_Inputs.FindPtr( "WakeNumIter" );
         if ( nvd )
         {
@@ -1889,6 +1906,7 @@ string VSPAEROSweepAnalysis::Execute()
 
         //    Case Setup
         VSPAEROMgr.m_NCPU.Set( ncpuOrig );
+        VSPAEROMgr.m_NumSweepWorkers.Set( numSweepWorkersOrig );
         VSPAEROMgr.m_WakeNumIter.Set( wakeNumIterOrig );
         VSPAEROMgr.m_WakeAvgStartIter.Set( wakeAvgStartIterOrig );
         VSPAEROMgr.m_WakeSkipUntilIter.Set( wakeSkipUntilIterOrig );
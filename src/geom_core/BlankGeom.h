@@ -25,6 +25,11 @@ public:
 
     virtual void UpdateSurf();
     virtual void UpdateDrawObj();
+
+    virtual bool SurfDependsOnXForm()
+    {
+        return true;
+    }
     virtual void LoadDrawObjs(vector< DrawObj* > & draw_obj_vec);
 
     virtual void ReadV2File( xmlNodePtr &root );
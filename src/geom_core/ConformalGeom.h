@@ -31,6 +31,11 @@ public:
 
     virtual void Scale();
 
+    virtual bool SurfDependsOnXForm()
+    {
+        return true;
+    }
+
     Parm m_Offset;                  // Offset to Conformal Surface
 
     BoolParm m_UTrimFlag;
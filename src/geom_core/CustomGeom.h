@@ -174,6 +174,12 @@ public:
 
     void Clear();
     void InitGeom( );
+
+    //==== Scripts May Read Anything - Always Rebuild ====//
+    virtual bool SurfDependsOnXForm()
+    {
+        return true;
+    }
     void SetScriptModuleName( const string& name )      { m_ScriptModuleName = name; }
     string GetScriptModuleName()                        { return m_ScriptModuleName; }
     void SetDisplayName( const string& name )      { m_DisplayName = name; }
@@ -1415,6 +1415,307 @@ void DegenGeom::write_degenGeomM_file( FILE* file_id )
     }
 }
 
+static vector< uint64_t > bin_dims( uint64_t d0, uint64_t d1, uint64_t d2 = 0 )
+{
+    vector< uint64_t > dims;
+    dims.push_back( d0 );
+    dims.push_back( d1 );
+    if ( d2 > 0 )
+    {
+        dims.push_back( d2 );
+    }
+    return dims;
+}
+
+void DegenGeom::write_degenGeomSurfBin_file( DegenBinWriter &writer, int nxsecs )
+{
+    writer.BeginArray( "SURFACE_NODE", "x,y,z,u,w", bin_dims( nxsecs, num_pnts, 5 ) );
+    for ( int i = 0; i < nxsecs; i++ )
+    {
+        for ( int j = 0; j < num_pnts; j++ )
+        {
+            double row[5] = { degenSurface.x[i][j].x(),
+                              degenSurface.x[i][j].y(),
+                              degenSurface.x[i][j].z(),
+                              degenSurface.u[i][j],
+                              degenSurface.w[i][j] };
+            writer.WriteRow( row, 5 );
+        }
+    }
+    writer.EndArray();
+
+    writer.BeginArray( "SURFACE_FACE", "nx,ny,nz,area", bin_dims( nxsecs - 1, num_pnts - 1, 4 ) );
+    for ( int i = 0; i < nxsecs - 1; i++ )
+    {
+        for ( int j = 0; j < num_pnts - 1; j++ )
+        {
+            double row[4] = { degenSurface.nvec[i][j].x(),
+                              degenSurface.nvec[i][j].y(),
+                              degenSurface.nvec[i][j].z(),
+                              degenSurface.area[i][j] };
+            writer.WriteRow( row, 4 );
+        }
+    }
+    writer.EndArray();
+}
+
+void DegenGeom::write_degenGeomPlateBin_file( DegenBinWriter &writer, int nxsecs, DegenPlate &degenPlate, int iplate )
+{
+    int npts = ( num_pnts + 1 ) / 2;
+    string basename = "PLATE" + std::to_string( ( long long ) iplate );
+
+    writer.BeginArray( basename + "_NORMAL", "nx,ny,nz", bin_dims( nxsecs, 3 ) );
+    for ( int i = 0; i < nxsecs; i++ )
+    {
+        writer.WriteRow( degenPlate.nPlate[i].v, 3 );
+    }
+    writer.EndArray();
+
+    writer.BeginArray( basename, "x,y,z,zCamber,t,nCamberx,nCambery,nCamberz,u,wTop,wBot", bin_dims( nxsecs, npts, 11 ) );
+    for ( int i = 0; i < nxsecs; i++ )
+    {
+        for ( int j = 0; j < npts; j++ )
+        {
+            double row[11] = { degenPlate.x[i][j].x(),
+                               degenPlate.x[i][j].y(),
+                               degenPlate.x[i][j].z(),
+                               degenPlate.zcamber[i][j],
+                               degenPlate.t[i][j],
+                               degenPlate.nCamber[i][j].x(),
+                               degenPlate.nCamber[i][j].y(),
+                               degenPlate.nCamber[i][j].z(),
+                               degenPlate.u[i][j],
+                               degenPlate.wTop[i][j],
+                               degenPlate.wBot[i][j] };
+            writer.WriteRow( row, 11 );
+        }
+    }
+    writer.EndArray();
+}
+
+void DegenGeom::write_degenGeomStickBin_file( DegenBinWriter &writer, int nxsecs, DegenStick &degenStick, int istick )
+{
+    string basename = "STICK" + std::to_string( ( long long ) istick );
+
+    writer.BeginArray( basename + "_NODE",
+                       "lex,ley,lez,tex,tey,tez,cgShellx,cgShelly,cgShellz,"
+                       "cgSolidx,cgSolidy,cgSolidz,toc,tLoc,chord,Ishell11,Ishell22,"
+                       "Ishell12,Isolid11,Isolid22,Isolid12,sectArea,sectNormalx,"
+                       "sectNormaly,sectNormalz,perimTop,perimBot,u,"
+                       "t00,t01,t02,t03,t10,t11,t12,t13,t20,t21,t22,t23,t30,t31,t32,t33,"
+                       "it00,it01,it02,it03,it10,it11,it12,it13,it20,it21,it22,it23,it30,it31,it32,it33,"
+                       "toc2,tLoc2,anglele,anglete,radleTop,radleBot",
+                       bin_dims( nxsecs, 66 ) );
+    for ( int i = 0; i < nxsecs; i++ )
+    {
+        double row[28] = { degenStick.xle[i].x(),
+                           degenStick.xle[i].y(),
+                           degenStick.xle[i].z(),
+                           degenStick.xte[i].x(),
+                           degenStick.xte[i].y(),
+                           degenStick.xte[i].z(),
+                           degenStick.xcgShell[i].x(),
+                           degenStick.xcgShell[i].y(),
+                           degenStick.xcgShell[i].z(),
+                           degenStick.xcgSolid[i].x(),
+                           degenStick.xcgSolid[i].y(),
+                           degenStick.xcgSolid[i].z(),
+                           degenStick.toc[i],
+                           degenStick.tLoc[i],
+                           degenStick.chord[i],
+                           degenStick.Ishell[i][0],
+                           degenStick.Ishell[i][1],
+                           degenStick.Ishell[i][2],
+                           degenStick.Isolid[i][0],
+                           degenStick.Isolid[i][1],
+                           degenStick.Isolid[i][2],
+                           degenStick.sectarea[i],
+                           degenStick.sectnvec[i].x(),
+                           degenStick.sectnvec[i].y(),
+                           degenStick.sectnvec[i].z(),
+                           degenStick.perimTop[i],
+                           degenStick.perimBot[i],
+                           degenStick.u[i] };
+        writer.WriteRow( row, 28 );
+        writer.WriteRow( &degenStick.transmat[i][0], 16 );
+        writer.WriteRow( &degenStick.invtransmat[i][0], 16 );
+
+        double tail[6] = { degenStick.toc2[i],
+                           degenStick.tLoc2[i],
+                           degenStick.anglele[i],
+                           degenStick.anglete[i],
+                           degenStick.radleTop[i],
+                           degenStick.radleBot[i] };
+        writer.WriteRow( tail, 6 );
+    }
+    writer.EndArray();
+
+    writer.BeginArray( basename + "_FACE", "sweeple,sweepte,areaTop,areaBot", bin_dims( nxsecs - 1, 4 ) );
+    for ( int i = 0; i < nxsecs - 1; i++ )
+    {
+        double row[4] = { degenStick.sweeple[i],
+                          degenStick.sweepte[i],
+                          degenStick.areaTop[i],
+                          degenStick.areaBot[i] };
+        writer.WriteRow( row, 4 );
+    }
+    writer.EndArray();
+}
+
+void DegenGeom::write_degenGeomPointBin_file( DegenBinWriter &writer )
+{
+    double row[22] = { degenPoint.vol[0],
+                       degenPoint.volWet[0],
+                       degenPoint.area[0],
+                       degenPoint.areaWet[0],
+                       degenPoint.Ishell[0][0],
+                       degenPoint.Ishell[0][1],
+                       degenPoint.Ishell[0][2],
+                       degenPoint.Ishell[0][3],
+                       degenPoint.Ishell[0][4],
+                       degenPoint.Ishell[0][5],
+                       degenPoint.Isolid[0][0],
+                       degenPoint.Isolid[0][1],
+                       degenPoint.Isolid[0][2],
+                       degenPoint.Isolid[0][3],
+                       degenPoint.Isolid[0][4],
+                       degenPoint.Isolid[0][5],
+                       degenPoint.xcgShell[0].x(),
+                       degenPoint.xcgShell[0].y(),
+                       degenPoint.xcgShell[0].z(),
+                       degenPoint.xcgSolid[0].x(),
+                       degenPoint.xcgSolid[0].y(),
+                       degenPoint.xcgSolid[0].z() };
+
+    writer.AddArray( "POINT",
+                     "vol,volWet,area,areaWet,Ishellxx,Ishellyy,Ishellzz,Ishellxy,"
+                     "Ishellxz,Ishellyz,Isolidxx,Isolidyy,Isolidzz,Isolidxy,Isolidxz,"
+                     "Isolidyz,cgShellx,cgShelly,cgShellz,cgSolidx,cgSolidy,cgSolidz",
+                     bin_dims( 1, 22 ), row );
+}
+
+void DegenGeom::write_degenGeomDiskBin_file( DegenBinWriter &writer )
+{
+    double row[7] = { degenDisk.d,
+                      degenDisk.x.x(),
+                      degenDisk.x.y(),
+                      degenDisk.x.z(),
+                      degenDisk.nvec.x(),
+                      degenDisk.nvec.y(),
+                      degenDisk.nvec.z() };
+
+    writer.AddArray( "PROP", "diameter,x,y,z,nx,ny,nz", bin_dims( 1, 7 ), row );
+}
+
+void DegenGeom::write_degenSubSurfBin_file( DegenBinWriter &writer, int isubsurf )
+{
+    DegenSubSurf &dss = degenSubSurfs[isubsurf];
+    string basename = "SUBSURF" + std::to_string( ( long long ) isubsurf );
+
+    writer.AddAttr( basename + "_name", dss.name );
+    writer.AddAttr( basename + "_typeName", dss.typeName );
+    writer.AddAttr( basename + "_typeId", std::to_string( ( long long ) dss.typeId ) );
+    writer.AddAttr( basename + "_fullName", dss.fullName );
+    writer.AddAttr( basename + "_testType", std::to_string( ( long long ) dss.testType ) );
+
+    int n = dss.u.size();
+
+    writer.BeginArray( basename + "_BNDY", "u,w,x,y,z", bin_dims( n, 5 ) );
+    for ( int i = 0; i < n; i++ )
+    {
+        double row[5] = { dss.u[i], dss.w[i], dss.x[i].x(), dss.x[i].y(), dss.x[i].z() };
+        writer.WriteRow( row, 5 );
+    }
+    writer.EndArray();
+}
+
+void DegenGeom::write_degenHingeLineBin_file( DegenBinWriter &writer, int ihingeline )
+{
+    DegenHingeLine &dhl = degenHingeLines[ihingeline];
+    string basename = "HINGELINE" + std::to_string( ( long long ) ihingeline );
+
+    writer.AddAttr( basename + "_name", dhl.name );
+
+    int n = dhl.uStart.size();
+
+    writer.BeginArray( basename, "uStart,uEnd,wStart,wEnd,xStart,yStart,zStart,xEnd,yEnd,zEnd", bin_dims( n, 10 ) );
+    for ( int i = 0; i < n; i++ )
+    {
+        double row[10] = { dhl.uStart[i],
+                           dhl.uEnd[i],
+                           dhl.wStart[i],
+                           dhl.wEnd[i],
+                           dhl.xStart[i].x(),
+                           dhl.xStart[i].y(),
+                           dhl.xStart[i].z(),
+                           dhl.xEnd[i].x(),
+                           dhl.xEnd[i].y(),
+                           dhl.xEnd[i].z() };
+        writer.WriteRow( row, 10 );
+    }
+    writer.EndArray();
+}
+
+//==== One Chunk Per Component - Arrays Mirror The CSV Blocks Column For Column ====//
+void DegenGeom::write_degenGeomBin_file( DegenBinWriter &writer )
+{
+    int nxsecs = num_xsecs;
+
+    if( type == SURFACE_TYPE )
+    {
+        writer.BeginChunk( "LIFTING_SURFACE" );
+    }
+    else if( type == DISK_TYPE )
+    {
+        writer.BeginChunk( "DISK" );
+    }
+    else
+    {
+        writer.BeginChunk( "BODY" );
+    }
+
+    writer.AddAttr( "name", name );
+    writer.AddAttr( "surf_ndx", std::to_string( ( long long ) getSurfNum() ) );
+    writer.AddAttr( "geom_id", this->parentGeom->GetID() );
+
+    write_degenGeomSurfBin_file( writer, nxsecs );
+
+    if( type == DISK_TYPE )
+    {
+        write_degenGeomDiskBin_file( writer );
+        writer.EndChunk();
+        return;
+    }
+
+    write_degenGeomPlateBin_file( writer, nxsecs, degenPlates[0], 0 );
+
+    if ( type == DegenGeom::BODY_TYPE )
+    {
+        write_degenGeomPlateBin_file( writer, nxsecs, degenPlates[1], 1 );
+    }
+
+    write_degenGeomStickBin_file( writer, nxsecs, degenSticks[0], 0 );
+
+    if ( type == DegenGeom::BODY_TYPE )
+    {
+        write_degenGeomStickBin_file( writer, nxsecs, degenSticks[1], 1 );
+    }
+
+    write_degenGeomPointBin_file( writer );
+
+    for ( int i = 0; i < ( int )degenSubSurfs.size(); i++ )
+    {
+        write_degenSubSurfBin_file( writer, i );
+    }
+
+    for ( int i = 0; i < ( int )degenHingeLines.size(); i++ )
+    {
+        write_degenHingeLineBin_file( writer, i );
+    }
+
+    writer.EndChunk();
+}
+
 void DegenGeom::write_degenGeomResultsManager( vector< string> &degen_results_ids )
 {
     Results *res = ResultsMgr.CreateResults( "Degen_DegenGeom" );
@@ -14,6 +14,7 @@
 #include "Matrix.h"
 #include "SubSurface.h"
 #include "ResultsMgr.h"
+#include "DegenBinFile.h"
 
 using namespace std;
 
@@ -270,6 +271,15 @@ public:
     void write_degenSubSurfM_file( FILE* file_id, int isubsurf );
     void write_degenHingeLineM_file( FILE* file_id, int ihingeline );
 
+    void write_degenGeomBin_file( DegenBinWriter &writer );
+    void write_degenGeomSurfBin_file( DegenBinWriter &writer, int nxsecs );
+    void write_degenGeomPlateBin_file( DegenBinWriter &writer, int nxsecs, DegenPlate &degenPlate, int iplate );
+    void write_degenGeomStickBin_file( DegenBinWriter &writer, int nxsecs, DegenStick &degenStick, int istick );
+    void write_degenGeomPointBin_file( DegenBinWriter &writer );
+    void write_degenGeomDiskBin_file( DegenBinWriter &writer );
+    void write_degenSubSurfBin_file( DegenBinWriter &writer, int isubsurf );
+    void write_degenHingeLineBin_file( DegenBinWriter &writer, int ihingeline );
+
     void write_degenGeomResultsManager( vector< string> &degen_results_ids );
     void write_degenGeomDiskResultsManger( Results * res );
     void write_degenGeomSurfResultsManager( Results * res );
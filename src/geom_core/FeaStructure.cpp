@@ -61,6 +61,9 @@ void FeaStructure::ParmChanged( Parm* parm_ptr, int type )
     if ( type == Parm::SET )
     {
         m_LateUpdateFlag = true;
+
+        //==== Parent Geom Updates Structures In Its XForm Stage ====//
+        MarkParentGeomDirty( m_ParentGeomID, GeomBase::UPDATE_XFORM );
         return;
     }
 
@@ -897,6 +900,8 @@ void FeaPart::ParmChanged( Parm* parm_ptr, int type )
     if ( type == Parm::SET )
     {
         m_LateUpdateFlag = true;
+
+        MarkParentGeomDirty( m_ParentGeomID, GeomBase::UPDATE_XFORM );
         return;
     }
 
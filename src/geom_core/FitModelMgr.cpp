@@ -11,10 +11,17 @@
 #include "ParmMgr.h"
 #include "StlHelper.h"
 #include "PtCloudGeom.h"
+#include "LinkMgr.h"
+#include "AdvLinkMgr.h"
+#include "ThreadPool.h"
 
 #define CMINPACK_NO_DLL
 #include <cminpack.h>
 
+#include <chrono>
+
+#define FIT_PT_CHUNK 256
+
 vec3d TargetPt::GetMatchPt()
 {
     Geom* matchgeom = VehicleMgr.GetVehicle()->FindGeom( m_MatchGeom );
@@ -311,6 +318,9 @@ FitModelMgrSingleton::FitModelMgrSingleton()
 
     m_SelectBoxFlag.Init( "Select_Box_Flag", "FitModel", VehicleMgr.GetVehicle(), false, 0, 1 );
 
+    m_NumThreads.Init( "Num_Threads", "FitModel", VehicleMgr.GetVehicle(), 1, 0, 1000 );
+    m_NumThreads.SetDescript( "Threads for Jacobian columns and target point search, 0 for one per core" );
+
     m_GUIShown = false;
 
     m_SaveFitFileName = string( "DefaultFitModel.fit" );
@@ -669,19 +679,30 @@ void FitModelMgrSingleton::BuildPtrVec()
     }
 }
 
+//==== Each Point Only Reads Its Surface - Refine Chunks Of Points On All Threads ====//
 void FitModelMgrSingleton::RefineTargetUW()
 {
     ValidateTargetPts();
 
     int npt = m_TargetPts.size();
 
+    vector< Geom* > geom_vec( npt );
     for ( int i = 0 ; i < npt; i++ )
     {
-        TargetPt* tpt = m_TargetPts[i];
-        Geom* g = VehicleMgr.GetVehicle()->FindGeom( tpt->GetMatchGeom() );
-
-        tpt->RefineUW( g );
+        geom_vec[i] = VehicleMgr.GetVehicle()->FindGeom( m_TargetPts[i]->GetMatchGeom() );
     }
+
+    int nchunk = ( npt + FIT_PT_CHUNK - 1 ) / FIT_PT_CHUNK;
+
+    ThreadPool pool( m_NumThreads() );
+    pool.Run( nchunk, [&]( int ichunk )
+    {
+        int iend = std::min( npt, ( ichunk + 1 ) * FIT_PT_CHUNK );
+        for ( int i = ichunk * FIT_PT_CHUNK ; i < iend; i++ )
+        {
+            m_TargetPts[i]->RefineUW( geom_vec[i] );
+        }
+    } );
 }
 
 void FitModelMgrSingleton::SearchTargetUW()
@@ -690,15 +711,292 @@ void FitModelMgrSingleton::SearchTargetUW()
 
     int npt = m_TargetPts.size();
 
+    vector< Geom* > geom_vec( npt );
     for ( int i = 0 ; i < npt; i++ )
     {
-        TargetPt* tpt = m_TargetPts[i];
-        Geom* g = VehicleMgr.GetVehicle()->FindGeom( tpt->GetMatchGeom() );
+        geom_vec[i] = VehicleMgr.GetVehicle()->FindGeom( m_TargetPts[i]->GetMatchGeom() );
+    }
 
-        tpt->SearchUW( g );
+    int nchunk = ( npt + FIT_PT_CHUNK - 1 ) / FIT_PT_CHUNK;
+
+    ThreadPool pool( m_NumThreads() );
+    pool.Run( nchunk, [&]( int ichunk )
+    {
+        int iend = std::min( npt, ( ichunk + 1 ) * FIT_PT_CHUNK );
+        for ( int i = ichunk * FIT_PT_CHUNK ; i < iend; i++ )
+        {
+            m_TargetPts[i]->SearchUW( geom_vec[i] );
+        }
+    } );
+}
+
+//==== Copy The Match Geoms For Each Thread ====//
+// A variable's column can be found on a copy when the variable belongs to a
+// match Geom, no link or adv link carries it to other parms and no other match
+// Geom is attached below it.  Moving it then changes only that Geom's points.
+void FitModelMgrSingleton::BuildCloneVec()
+{
+    DelCloneVec();
+
+    int nvar = m_VarVec.size();
+    int npt = m_TargetPts.size();
+
+    m_CloneVarVec.assign( nvar, -1 );
+
+    int nthread = m_NumThreads();
+    if ( nthread <= 0 )
+    {
+        nthread = ThreadPool::GetNumHardwareThreads();
+    }
+
+    if ( nthread < 2 || nvar < 2 )
+    {
+        return;
+    }
+
+    Vehicle* veh = VehicleMgr.GetVehicle();
+
+    //==== Distinct Match Geoms ====//
+    m_TargetMatchVec.resize( npt );
+    for ( int i = 0 ; i < npt; i++ )
+    {
+        int imatch = vector_find_val( m_MatchGeomVec, m_TargetGeomPtrVec[i] );
+        if ( imatch < 0 )
+        {
+            imatch = m_MatchGeomVec.size();
+            m_MatchGeomVec.push_back( m_TargetGeomPtrVec[i] );
+        }
+        m_TargetMatchVec[i] = imatch;
+    }
+
+    int nmatch = m_MatchGeomVec.size();
+
+    vector< vector< string > > match_parm_vec( nmatch );
+    for ( int k = 0 ; k < nmatch; k++ )
+    {
+        m_MatchGeomVec[k]->AddLinkableParms( match_parm_vec[k] );
+    }
+
+    //==== Find Variables That Move Their Own Match Geom Alone ====//
+    vector< int > var_parm_indx( nvar, -1 );
+    for ( int j = 0 ; j < nvar; j++ )
+    {
+        string pid = m_VarVec[j];
+
+        bool linked = AdvLinkMgr.IsInputParm( pid ) || AdvLinkMgr.IsOutputParm( pid );
+        for ( int l = 0 ; l < LinkMgr.GetNumLinks() && !linked; l++ )
+        {
+            Link* pl = LinkMgr.GetLink( l );
+            if ( pl && ( pl->GetParmA() == pid || pl->GetParmB() == pid ) )
+            {
+                linked = true;
+            }
+        }
+
+        if ( linked )
+        {
+            continue;
+        }
+
+        for ( int k = 0 ; k < nmatch; k++ )
+        {
+            int indx = vector_find_val( match_parm_vec[k], pid );
+            if ( indx >= 0 )
+            {
+                vector< string > tree_vec;
+                m_MatchGeomVec[k]->LoadIDAndChildren( tree_vec );
+
+                bool shared = false;
+                for ( int kk = 0 ; kk < nmatch; kk++ )
+                {
+                    if ( kk != k && vector_contains_val( tree_vec, m_MatchGeomVec[kk]->GetID() ) )
+                    {
+                        shared = true;
+                    }
+                }
+
+                if ( !shared )
+                {
+                    m_CloneVarVec[j] = k;
+                    var_parm_indx[j] = indx;
+                }
+                break;
+            }
+        }
+    }
+
+    //==== Copy Each Match Geom That Has Variables, Once Per Thread ====//
+    m_CloneGeomVec.resize( nthread, vector< Geom* >( nmatch, NULL ) );
+    m_CloneParmVec.resize( nthread, vector< Parm* >( nvar, NULL ) );
+
+    int nclonevar = 0;
+    for ( int k = 0 ; k < nmatch; k++ )
+    {
+        if ( !vector_contains_val( m_CloneVarVec, k ) )
+        {
+            continue;
+        }
+
+        bool ok = true;
+        for ( int t = 0 ; t < nthread && ok; t++ )
+        {
+            Geom* clone = veh->CloneGeom( m_MatchGeomVec[k] );
+            if ( !clone )
+            {
+                ok = false;
+                break;
+            }
+            m_CloneGeomVec[t][k] = clone;
+
+            vector< string > clone_parm_vec;
+            clone->AddLinkableParms( clone_parm_vec );
+            if ( clone_parm_vec.size() != match_parm_vec[k].size() )
+            {
+                ok = false;
+                break;
+            }
+
+            clone->Update( false );
+
+            for ( int j = 0 ; j < nvar; j++ )
+            {
+                if ( m_CloneVarVec[j] == k )
+                {
+                    m_CloneParmVec[t][j] = ParmMgr.FindParm( clone_parm_vec[ var_parm_indx[j] ] );
+                    ok = ok && m_CloneParmVec[t][j];
+                }
+            }
+        }
+
+        for ( int j = 0 ; j < nvar; j++ )
+        {
+            if ( m_CloneVarVec[j] == k )
+            {
+                if ( ok )
+                {
+                    nclonevar++;
+                }
+                else
+                {
+                    m_CloneVarVec[j] = -1;
+                }
+            }
+        }
+    }
+
+    if ( nclonevar == 0 )
+    {
+        DelCloneVec();
+        m_CloneVarVec.assign( nvar, -1 );
     }
 }
 
+void FitModelMgrSingleton::DelCloneVec()
+{
+    for ( int t = 0 ; t < ( int )m_CloneGeomVec.size(); t++ )
+    {
+        for ( int k = 0 ; k < ( int )m_CloneGeomVec[t].size(); k++ )
+        {
+            delete m_CloneGeomVec[t][k];
+        }
+    }
+
+    m_CloneGeomVec.clear();
+    m_CloneParmVec.clear();
+    m_MatchGeomVec.clear();
+    m_TargetMatchVec.clear();
+
+    for ( int j = 0 ; j < ( int )m_CloneVarVec.size(); j++ )
+    {
+        m_CloneVarVec[j] = -1;
+    }
+}
+
+//==== Forward Difference Columns On The Match Geom Copies ====//
+void FitModelMgrSingleton::CalcCloneDeriv( const double *x, const double *y, double *yprm )
+{
+    int nvar = m_VarVec.size();
+    int npt = m_TargetPts.size();
+    int m = 3 * npt;
+    int nthread = m_CloneGeomVec.size();
+
+    double eps = sqrt( dpmpar( 1.0 ) ); // sqrt of machine precision
+
+    vector< int > col_vec;
+    for ( int j = 0 ; j < nvar; j++ )
+    {
+        if ( m_CloneVarVec[j] >= 0 )
+        {
+            col_vec.push_back( j );
+        }
+    }
+
+    // Columns are dealt to threads in a fixed order so each copy sees the same steps every time
+    ThreadPool pool( nthread );
+    pool.Run( nthread, [&]( int ithread )
+    {
+        vector< Geom* > & clone_vec = m_CloneGeomVec[ ithread ];
+        vector< Parm* > & parm_vec = m_CloneParmVec[ ithread ];
+
+        // Parents may have moved since the last Jacobian
+        for ( int k = 0 ; k < ( int )clone_vec.size(); k++ )
+        {
+            if ( clone_vec[k] )
+            {
+                clone_vec[k]->MarkDirty( GeomBase::UPDATE_XFORM );
+            }
+        }
+
+        for ( int c = ithread ; c < ( int )col_vec.size(); c += nthread )
+        {
+            int j = col_vec[c];
+            int imatch = m_CloneVarVec[j];
+            Geom* clone = clone_vec[ imatch ];
+
+            // Back to x, then step this variable alone
+            for ( int jj = 0 ; jj < nvar; jj++ )
+            {
+                if ( m_CloneVarVec[jj] == imatch )
+                {
+                    parm_vec[jj]->Set( x[jj] );
+                }
+            }
+
+            double x0 = x[j];
+            double dx = eps * std::abs( x0 );
+            if ( dx == 0. )
+            {
+                dx = eps;
+            }
+
+            parm_vec[j]->Set( x0 + dx );
+            clone->Update( false );
+
+            VspSurf* s = clone->GetSurfPtr();
+
+            for ( int i = 0 ; i < npt; i++ )
+            {
+                if ( m_TargetMatchVec[i] == imatch )
+                {
+                    TargetPt* tpt = m_TargetPts[i];
+                    vec2d uw = tpt->GetUW();
+                    vec3d delta = s->CompPnt01( uw.x(), uw.y() ) - tpt->GetPt();
+
+                    yprm[3 * i + j * m] = ( delta.x() - y[3 * i] ) / dx;
+                    yprm[3 * i + 1 + j * m] = ( delta.y() - y[3 * i + 1] ) / dx;
+                    yprm[3 * i + 2 + j * m] = ( delta.z() - y[3 * i + 2] ) / dx;
+                }
+                else
+                {
+                    yprm[3 * i + j * m] = 0.0;
+                    yprm[3 * i + 1 + j * m] = 0.0;
+                    yprm[3 * i + 2 + j * m] = 0.0;
+                }
+            }
+        }
+    } );
+}
+
 void FitModelMgrSingleton::ParmToX( double *x )
 {
     int nvar = m_VarVec.size();
@@ -840,6 +1138,8 @@ void FitModelMgrSingleton::CalcMetrics( const double *x, double *y )
 
 void FitModelMgrSingleton::CalcMetricDeriv( const double *x, double *y, double *yprm )
 {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
     int n = m_NumOptVars;
     int nvar = m_VarVec.size();
     int npt = m_TargetPts.size();
@@ -860,9 +1160,25 @@ void FitModelMgrSingleton::CalcMetricDeriv( const double *x, double *y, double *
 
     double eps = sqrt( dpmpar( 1.0 ) ); // sqrt of machine precision
 
+    //==== Columns That Only Move Their Own Match Geom Run On Copies ====//
+    if ( !m_CloneGeomVec.empty() )
+    {
+        // Copies read their parents from the Vehicle, which must sit at x
+        XtoParm( x );
+        VehicleMgr.GetVehicle()->Update( false );
+
+        CalcCloneDeriv( x, y, yprm );
+    }
+
     xindx = 0;
     for (j = 0; j < nvar; ++j)
     {
+        if ( m_CloneVarVec[j] >= 0 )
+        {
+            xindx++;
+            continue;
+        }
+
         x0 = xp[xindx];
         dx = eps * std::abs(x0);
         if (dx == 0.)
@@ -923,6 +1239,37 @@ void FitModelMgrSingleton::CalcMetricDeriv( const double *x, double *y, double *
 
     delete [] fprm;
     delete [] xp;
+
+    //==== Time Jacobian And Time Since The Last One ====//
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+    m_DerivTimeVec.push_back( std::chrono::duration< double >( end - start ).count() );
+    m_IterTimeVec.push_back( std::chrono::duration< double >( end - m_IterStart ).count() );
+    m_IterStart = end;
+}
+
+//==== Jacobian At The Current Variables, Column Major As In Optimize ====//
+void FitModelMgrSingleton::CalcJacobian( vector< double > & jac )
+{
+    ValidateTargetPts();
+
+    BuildPtrVec();
+    BuildCloneVec();
+
+    int n = m_NumOptVars;
+    int m = 3 * m_TargetPts.size();
+
+    vector< double > x( n );
+    vector< double > y( m );
+    jac.assign( m * n, 0.0 );
+
+    ParmToX( x.data() );
+    CalcMetrics( x.data(), y.data() );
+    CalcMetricDeriv( x.data(), y.data(), jac.data() );
+
+    DelCloneVec();
+
+    m_ParmPtrVec.clear();
+    m_TargetGeomPtrVec.clear();
 }
 
 int FitModelMgrSingleton::Optimize()
@@ -930,6 +1277,11 @@ int FitModelMgrSingleton::Optimize()
     ValidateTargetPts();
 
     BuildPtrVec();
+    BuildCloneVec();
+
+    m_DerivTimeVec.clear();
+    m_IterTimeVec.clear();
+    m_IterStart = std::chrono::steady_clock::now();
 
     int nvar = m_NumOptVars;
     int npt = m_TargetPts.size();
@@ -970,9 +1322,23 @@ int FitModelMgrSingleton::Optimize()
 
     int info = lmder1( fcn, NULL, m, nvar, x, y, fjac, ldfjac, tol, ipvt, wa, lwa );
 
+    int nclonevar = m_CloneVarVec.size() - std::count( m_CloneVarVec.begin(), m_CloneVarVec.end(), -1 );
+    int nthread = m_CloneGeomVec.size();
+    DelCloneVec();
+
     XtoParm( x );
     VehicleMgr.GetVehicle()->ForceUpdate();
 
+    //==== Per Iteration Timing ====//
+    Results* res = ResultsMgr.CreateResults( "FitModel_Timing" );
+    if ( res )
+    {
+        res->Add( NameValData( "Num_Threads", std::max( nthread, 1 ) ) );
+        res->Add( NameValData( "Num_Thread_Vars", nclonevar ) );
+        res->Add( NameValData( "Jacobian_Time", m_DerivTimeVec ) );
+        res->Add( NameValData( "Iteration_Time", m_IterTimeVec ) );
+    }
+
     m_ParmPtrVec.clear();
     m_TargetGeomPtrVec.clear();
 
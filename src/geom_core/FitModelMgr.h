@@ -17,6 +17,7 @@
 
 #include <vector>
 #include <string>
+#include <chrono>
 
 #define MIN_FIT_FILE_VER 1
 #define CURRENT_FIT_FILE_VER 1
@@ -206,6 +207,7 @@ public:
 
     void CalcMetrics( const double *x, double *y );
     void CalcMetricDeriv( const double *x, double *y, double *yprm );
+    void CalcJacobian( vector< double > & jac );
 
     void UpdateDist();
     int Optimize();
@@ -278,6 +280,8 @@ public:
     Parm m_UTargetPt;
     Parm m_WTargetPt;
 
+    IntParm m_NumThreads;
+
     double m_DistMetric;
 
 private:
@@ -290,6 +294,9 @@ private:
     void Wype();
 
     void BuildPtrVec();
+    void BuildCloneVec();
+    void DelCloneVec();
+    void CalcCloneDeriv( const double *x, const double *y, double *yprm );
     void ParmToX( double *x );
     void XtoParm( const double *x );
     double Clamp01( double x, bool closed );
@@ -314,6 +321,19 @@ private:
     vector < Geom* > m_TargetGeomPtrVec;
     int m_NumOptVars;
 
+    // Copies of the match Geoms, one set per thread, for evaluating Jacobian
+    // columns concurrently.  m_CloneVarVec[j] indexes the copy that variable j
+    // moves, or is -1 when the column must be found on the Vehicle itself.
+    vector < Geom* > m_MatchGeomVec;
+    vector < int > m_TargetMatchVec;
+    vector < int > m_CloneVarVec;
+    vector < vector < Geom* > > m_CloneGeomVec;
+    vector < vector < Parm* > > m_CloneParmVec;
+
+    vector < double > m_DerivTimeVec;
+    vector < double > m_IterTimeVec;
+    std::chrono::steady_clock::time_point m_IterStart;
+
     DrawObj m_TargetPntDrawObj;
     DrawObj m_TargetLineDrawObj;
 
@@ -11,6 +11,7 @@
 #include "DXFUtil.h"
 #include "SVGUtil.h"
 #include "StringUtil.h"
+#include "Util.h"
 #include "ParmMgr.h"
 #include "SubSurfaceMgr.h"
 #include "HingeGeom.h"
@@ -52,6 +53,25 @@ void GeomType::CopyFrom( const GeomType & t )
     m_GeomID = t.m_GeomID;
 }
 
+//==== Constructor ====//
+SurfTessCache::SurfTessCache()
+{
+    Clear();
+}
+
+void SurfTessCache::Clear()
+{
+    m_Valid = false;
+    m_FeatureValid = false;
+    m_FlipNormal = false;
+
+    m_Pnts.clear();
+    m_Norms.clear();
+    m_UTex.clear();
+    m_VTex.clear();
+    m_FeaturePnts.clear();
+}
+
 
 
 
@@ -104,6 +124,9 @@ GeomBase::GeomBase( Vehicle* vehicle_ptr )
     m_Type.m_Type = BASE_GEOM_TYPE;
     m_Type.m_Name = m_Name;
     m_ParentID = string( "NONE" );
+
+    m_DirtyStage = UPDATE_NONE;
+    m_PartialStage = UPDATE_NONE;
 }
 
 //==== Destructor ====//
@@ -120,6 +143,8 @@ void GeomBase::ParmChanged( Parm* parm_ptr, int type )
         m_UpdatedParmVec.push_back( parm_ptr->GetID() );
     }
 
+    MarkDirty( GetParmStage( parm_ptr ) );
+
     if ( type == Parm::SET )
     {
         m_LateUpdateFlag = true;
@@ -143,12 +168,25 @@ void GeomBase::ParmChanged( Parm* parm_ptr, int type )
 void GeomBase::ForceUpdate()
 {
     m_LateUpdateFlag = true;
+    MarkDirty( UPDATE_SURF );
     m_Vehicle->Update();
     m_Vehicle->UpdateGui();
 
     m_UpdatedParmVec.clear();
 }
 
+//==== Check If Anything Changed Since Last Update ====//
+bool GeomBase::IsDirty( bool fullupdate )
+{
+    if ( m_LateUpdateFlag || m_DirtyStage != UPDATE_NONE )
+    {
+        return true;
+    }
+
+    // Feature lines, sub-surfaces and draw objects skipped by a partial update
+    return fullupdate && m_PartialStage != UPDATE_NONE;
+}
+
 //==== Check If Parm Is In Updated ParmVec ====//
 bool GeomBase::UpdatedParm( const string & id )
 {
@@ -419,6 +457,23 @@ void GeomXForm::Update( bool fullupdate )
     }
 }
 
+//==== Transform Parms Only Reach The XForm Stage ====//
+int GeomXForm::GetParmStage( Parm* parm_ptr )
+{
+    if ( parm_ptr == &m_XLoc || parm_ptr == &m_YLoc || parm_ptr == &m_ZLoc ||
+         parm_ptr == &m_XRelLoc || parm_ptr == &m_YRelLoc || parm_ptr == &m_ZRelLoc ||
+         parm_ptr == &m_XRot || parm_ptr == &m_YRot || parm_ptr == &m_ZRot ||
+         parm_ptr == &m_XRelRot || parm_ptr == &m_YRelRot || parm_ptr == &m_ZRelRot ||
+         parm_ptr == &m_Origin || parm_ptr == &m_AbsRelFlag ||
+         parm_ptr == &m_TransAttachFlag || parm_ptr == &m_RotAttachFlag ||
+         parm_ptr == &m_ULoc || parm_ptr == &m_WLoc )
+    {
+        return UPDATE_XFORM;
+    }
+
+    return UPDATE_SURF;
+}
+
 //==== Compose Model Matrix =====//
 void GeomXForm::ComposeModelMatrix()
 {
@@ -759,6 +814,15 @@ Geom::Geom( Vehicle* vehicle_ptr ) : GeomXForm( vehicle_ptr )
     m_TessW.SetDescript( "Number of tessellated curves in the W direction" );
     m_TessW.SetMultShift( 4, 1 );
 
+    m_AdaptTessFlag.Init( "AdaptTessFlag", "Shape", this, false, 0, 1 );
+    m_AdaptTessFlag.SetDescript( "Flag to refine the tessellation until the adaptive tolerances are met" );
+    m_AdaptChordTol.Init( "AdaptChordTol", "Shape", this, 0.001, 1e-6, 1.0 );
+    m_AdaptChordTol.SetDescript( "Maximum chordal deviation, as a fraction of the surface bounding box diagonal" );
+    m_AdaptAngleTol.Init( "AdaptAngleTol", "Shape", this, 10.0, 0.1, 90.0 );
+    m_AdaptAngleTol.SetDescript( "Maximum change in surface normal (deg) across a tessellation interval" );
+    m_AdaptMaxPass.Init( "AdaptMaxPass", "Shape", this, 4, 1, 10 );
+    m_AdaptMaxPass.SetDescript( "Maximum number of adaptive refinement passes, each can double the curves up to a limit of 1000" );
+
     m_WakeActiveFlag.Init( "Wake", "Shape", this, false, 0, 1 );
 
     m_BbXLen.Init( "X_Len", "BBox", this, 0, 0, 1e12 );
@@ -976,24 +1040,49 @@ void Geom::Update( bool fullupdate )
 
     m_LateUpdateFlag = false;
 
-    m_CappingDone = false;
+    //==== Only A Move Since Last Time - Keep The Main Surfaces ====//
+    int stage = m_DirtyStage;
+    if ( fullupdate )
+    {
+        stage |= m_PartialStage;
+    }
+    bool surf_flag = ( stage != UPDATE_XFORM ) || SurfDependsOnXForm();
 
-    Scale();
+    if ( m_Vehicle )
+    {
+        m_Vehicle->CountGeomUpdate( surf_flag );
+    }
+
+    if ( surf_flag )
+    {
+        m_CappingDone = false;
+
+        Scale();
+    }
 
     UpdateSets();
 
-    UpdateSurf();       // Must be implemented by subclass.
+    if ( surf_flag )
+    {
+        UpdateSurf();       // Must be implemented by subclass.
 
-    GeomXForm::Update();
+        m_TessCacheVec.clear();
+    }
 
-    UpdateEndCaps();
+    GeomXForm::Update();
 
-    if ( fullupdate )
+    if ( surf_flag )
     {
-        UpdateFeatureLines();
-    }
+        UpdateEndCaps();
 
-    UpdateFlags();
+        if ( fullupdate )
+        {
+            UpdateFeatureLines();
+        }
+
+        UpdateFlags();
+        UpdateAdaptTess();
+    }
 
     UpdateSymmAttach();
 
@@ -1016,12 +1105,53 @@ void Geom::Update( bool fullupdate )
     if ( fullupdate )
     {
         UpdateDrawObj();
+        m_PartialStage = UPDATE_NONE;
+    }
+    else
+    {
+        m_PartialStage |= surf_flag ? UPDATE_SURF : UPDATE_XFORM;
     }
 
+    // Output parms set during the update do not count as changes
+    m_LateUpdateFlag = false;
+    m_DirtyStage = UPDATE_NONE;
+
     m_UpdatedParmVec.clear();
     m_UpdateBlock = false;
 }
 
+//==== Symmetry Parms Only Reach The XForm Stage ====//
+int Geom::GetParmStage( Parm* parm_ptr )
+{
+    if ( parm_ptr == &m_SymAncestor || parm_ptr == &m_SymAncestOriginFlag ||
+         parm_ptr == &m_SymPlanFlag || parm_ptr == &m_SymAxFlag || parm_ptr == &m_SymRotN )
+    {
+        return UPDATE_XFORM;
+    }
+
+    return GeomXForm::GetParmStage( parm_ptr );
+}
+
+void Geom::MarkDirty( int stage )
+{
+    // Parms set by the update itself are outputs
+    if ( !m_UpdateBlock )
+    {
+        GeomXForm::MarkDirty( stage );
+    }
+}
+
+//==== Late Update Without A Parm Rebuilds Everything ====//
+void Geom::SetLateUpdateFlag( bool flag )
+{
+    GeomXForm::SetLateUpdateFlag( flag );
+
+    if ( flag )
+    {
+        MarkDirty( UPDATE_SURF );
+    }
+}
+
 void Geom::GetUWTess01( int indx, vector < double > &u, vector < double > &w )
 {
     vector< vector< vec3d > > pnts;
@@ -1063,6 +1193,113 @@ void Geom::UpdateSplitTesselate( int indx, vector< vector< vector< vec3d > > > &
     m_SurfVec[indx].SplitTesselate( m_TessU(), m_TessW(), pnts, norms, m_CapUMinTess() );
 }
 
+//==== Tessellate The Main Surface Behind m_SurfVec[indx] Unless Already Cached ====//
+void Geom::UpdateTessCache( int indx, double tol )
+{
+    int imain = m_SurfIndxVec[indx];
+    if ( imain >= ( int )m_TessCacheVec.size() )
+    {
+        m_TessCacheVec.resize( imain + 1 );
+    }
+    SurfTessCache & cache = m_TessCacheVec[imain];
+
+    if ( !cache.m_Valid )
+    {
+        cache.Clear();
+
+        UpdateSplitTesselate( indx, cache.m_Pnts, cache.m_Norms );
+        CalcTexCoords( indx, cache.m_UTex, cache.m_VTex, cache.m_Pnts );
+
+        cache.m_Mat = m_SurfTransMatVec[indx];
+        cache.m_InvMat = cache.m_Mat;
+        cache.m_InvMat.affineInverse();
+        cache.m_FlipNormal = m_SurfVec[indx].GetFlipNormal();
+        cache.m_Valid = true;
+    }
+
+    if ( m_GuiDraw.GetDispFeatureFlag() && !cache.m_FeatureValid )
+    {
+        int nu = m_SurfVec[indx].GetNumUFeature();
+        for( int j = 0; j < nu; j++ )
+        {
+            vector < vec3d > ptline;
+            m_SurfVec[indx].TessUFeatureLine( j, ptline, tol );
+
+            int n = ptline.size() - 1;
+
+            cache.m_FeaturePnts.reserve( cache.m_FeaturePnts.size() + 2 * n );
+
+            for ( int k = 0; k < n; k++ )
+            {
+                cache.m_FeaturePnts.push_back( ptline[ k ] );
+                cache.m_FeaturePnts.push_back( ptline[ k + 1 ] );
+            }
+        }
+
+        int nw = m_SurfVec[indx].GetNumWFeature();
+        for( int j = 0; j < nw; j++ )
+        {
+            vector < vec3d > ptline;
+            m_SurfVec[indx].TessWFeatureLine( j, ptline, tol );
+
+            int n = ptline.size() - 1;
+
+            cache.m_FeaturePnts.reserve( cache.m_FeaturePnts.size() + 2 * n );
+
+            for ( int k = 0; k < n; k++ )
+            {
+                cache.m_FeaturePnts.push_back( ptline[ k ] );
+                cache.m_FeaturePnts.push_back( ptline[ k + 1 ] );
+            }
+        }
+
+        // Lines are kept in the frame of the cached tessellation
+        Matrix4d to_cache = cache.m_InvMat;
+        to_cache.matMult( m_SurfTransMatVec[indx].data() );
+        to_cache.xformvec( cache.m_FeaturePnts );
+
+        cache.m_FeatureValid = true;
+    }
+}
+
+//==== Move The Cached Main Surface Tessellation Onto m_SurfVec[indx] ====//
+void Geom::ApplyTessCache( int indx, vector< vector< vector< vec3d > > > &pnts, vector< vector< vector< vec3d > > > &norms )
+{
+    const SurfTessCache & cache = m_TessCacheVec[ m_SurfIndxVec[indx] ];
+
+    Matrix4d inv = cache.m_InvMat;
+    Matrix4d mat = m_SurfTransMatVec[indx];
+    mat.matMult( inv.data() );
+
+    // Reflections turn the computed normal, a flipped normal flag turns it back
+    double *m = mat.data();
+    double det = m[0] * ( m[5] * m[10] - m[9] * m[6] ) -
+                 m[4] * ( m[1] * m[10] - m[9] * m[2] ) +
+                 m[8] * ( m[1] * m[6] - m[5] * m[2] );
+
+    double sign = det < 0.0 ? -1.0 : 1.0;
+    if ( m_SurfVec[indx].GetFlipNormal() != cache.m_FlipNormal )
+    {
+        sign = -sign;
+    }
+
+    pnts = cache.m_Pnts;
+    norms = cache.m_Norms;
+
+    for ( int k = 0; k < ( int )pnts.size(); k++ )
+    {
+        for ( int i = 0; i < ( int )pnts[k].size(); i++ )
+        {
+            mat.xformvec( pnts[k][i] );
+
+            for ( int j = 0; j < ( int )norms[k][i].size(); j++ )
+            {
+                norms[k][i][j] = sign * mat.xformnorm( norms[k][i][j] );
+            }
+        }
+    }
+}
+
 void Geom::CalcTexCoords( int indx, vector< vector< vector< double > > > &utex, vector< vector< vector< double > > > &vtex, const vector< vector< vector< vec3d > > > & pnts )
 {
     int nu = m_SurfVec[indx].GetNumUFeature() - 1;
@@ -1387,12 +1624,14 @@ void Geom::UpdateSymmAttach()
 
     m_FeaTransMatVec.clear();
     m_FeaTransMatVec.resize( num_surf );
+    m_SurfTransMatVec.resize( num_surf );
 
     //==== Save Transformation Matrix and Apply Transformations ====//
     for ( int i = 0 ; i < num_surf ; i++ )
     {
         transMats[i].postMult( symmOriginMat.data() );
         m_SurfVec[i].Transform( transMats[i] ); // Apply total transformation to main surfaces
+        m_SurfTransMatVec[i] = transMats[i];
 
         m_FeaTransMatVec[i] = transMats[i];
         m_FeaTransMatVec[i].matMult( retrun_relTrans.data() ); // m_FeaTransMatVec does not inclde the relTrans matrix
@@ -1411,6 +1650,7 @@ void Geom::UpdateChildren( bool fullupdate )
             // Ignore the abs location values and only use rel values for children so a child
             // with abs button selected stays attached to parent if the parent moves
             child->m_ignoreAbsFlag = true;
+            child->MarkDirty( UPDATE_XFORM );
             child->Update( fullupdate );
             child->m_ignoreAbsFlag = false;
 
@@ -1459,6 +1699,17 @@ void Geom::UpdateFlags( )
     }
 }
 
+//==== Pass The Adaptive Tessellation Tolerances To The Main Surfaces ====//
+void Geom::UpdateAdaptTess()
+{
+    double chord_tol = m_AdaptTessFlag() ? m_AdaptChordTol() : 0.0;
+
+    for( int i = 0; i < (int)m_MainSurfVec.size(); i++ )
+    {
+        m_MainSurfVec[i].SetAdaptTess( chord_tol, m_AdaptAngleTol(), m_AdaptMaxPass() );
+    }
+}
+
 void Geom::WriteFeatureLinesDXF( FILE * file_name, const BndBox &dxfbox )
 {
     double tol = 10e-2; // Feature line tesselation tolerance
@@ -1983,18 +2234,21 @@ void Geom::UpdateDrawObj()
     m_WireShadeDrawObj_vec[0].m_GeomChanged = true;
     m_WireShadeDrawObj_vec[1].m_GeomChanged = true;
 
-    //==== Tesselate Surface ====//
+    //==== Tesselate Main Surfaces Once - Copies And Moves Reuse It ====//
     for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
     {
+        UpdateTessCache( i, tol );
+
+        const SurfTessCache & cache = m_TessCacheVec[ m_SurfIndxVec[i] ];
+
         vector< vector < vector < vec3d > > > pnts;
         vector< vector < vector < vec3d > > > norms;
 
-        UpdateSplitTesselate( i, pnts, norms );
-
-        vector< vector < vector < double > > > utex;
-        vector< vector < vector < double > > > vtex;
+        ApplyTessCache( i, pnts, norms );
 
-        CalcTexCoords( i, utex, vtex, pnts );
+        // Distance based, unchanged by a rigid transform
+        const vector< vector < vector < double > > > & utex = cache.m_UTex;
+        const vector< vector < vector < double > > > & vtex = cache.m_VTex;
 
         int iflip = 0;
         if ( m_SurfVec[i].GetFlipNormal() )
@@ -2014,38 +2268,17 @@ void Geom::UpdateDrawObj()
 
         if( m_GuiDraw.GetDispFeatureFlag() )
         {
-            int nu = m_SurfVec[i].GetNumUFeature();
-            for( int j = 0; j < nu; j++ )
-            {
-                vector < vec3d > ptline;
-                m_SurfVec[i].TessUFeatureLine( j, ptline, tol );
+            Matrix4d inv = cache.m_InvMat;
+            Matrix4d mat = m_SurfTransMatVec[i];
+            mat.matMult( inv.data() );
 
-                int n = ptline.size() - 1;
+            vector < vec3d > & featpnts = m_FeatureDrawObj_vec[0].m_PntVec;
+            int nstart = featpnts.size();
+            featpnts.insert( featpnts.end(), cache.m_FeaturePnts.begin(), cache.m_FeaturePnts.end() );
 
-                m_FeatureDrawObj_vec[0].m_PntVec.reserve( m_FeatureDrawObj_vec[0].m_PntVec.size() + 2 * n );
-
-                for ( int k = 0; k < n; k++ )
-                {
-                    m_FeatureDrawObj_vec[0].m_PntVec.push_back( ptline[ k ] );
-                    m_FeatureDrawObj_vec[0].m_PntVec.push_back( ptline[ k + 1 ] );
-                }
-            }
-
-            int nw = m_SurfVec[i].GetNumWFeature();
-            for( int j = 0; j < nw; j++ )
+            for ( int k = nstart; k < ( int )featpnts.size(); k++ )
             {
-                vector < vec3d > ptline;
-                m_SurfVec[i].TessWFeatureLine( j, ptline, tol );
-
-                int n = ptline.size() - 1;
-
-                m_FeatureDrawObj_vec[0].m_PntVec.reserve( m_FeatureDrawObj_vec[0].m_PntVec.size() + 2 * n );
-
-                for ( int k = 0; k < n; k++ )
-                {
-                    m_FeatureDrawObj_vec[0].m_PntVec.push_back( ptline[ k ] );
-                    m_FeatureDrawObj_vec[0].m_PntVec.push_back( ptline[ k + 1 ] );
-                }
+                featpnts[k] = mat.xform( featpnts[k] );
             }
         }
     }
@@ -4002,13 +4235,16 @@ void Geom::CreateGeomResults( Results* res )
         //==== Tessellate Surface ====//
         vector< vector< vec3d > > pnts;
         vector< vector< vec3d > > norms;
-        UpdateTesselate( i, pnts, norms, false );
+        vector< vector< vec3d > > uw_pnts;
+        UpdateTesselate( i, pnts, norms, uw_pnts, false );
 
         res->Add( NameValData( "Num_XSecs", static_cast<int>( pnts.size() ) ) );
 
         if ( pnts.size() )
         {
             res->Add( NameValData( "Num_Pnts_Per_XSec", static_cast<int>( pnts[0].size() ) ) );
+            res->Add( NameValData( "Num_Tris", 2 * static_cast<int>( ( pnts.size() - 1 ) * ( pnts[0].size() - 1 ) ) ) );
+            res->Add( NameValData( "Tess_Error", m_SurfVec[i].CompTessError( uw_pnts ) ) );
         }
 
         //==== Write XSec Data ====//
@@ -4297,6 +4533,39 @@ void Geom::AddLinkableParms( vector< string > & linkable_parm_vec, const string
     }
 }
 
+//==== Hash Parm Values, Sub Surfaces And Surfaces ====//
+unsigned long long Geom::GetStateHash()
+{
+    unsigned long long hash = HashString( m_ID );
+    hash = HashString( m_Name, hash );
+    hash = HashInt( GetType().m_Type, hash );
+
+    vector< string > parm_vec;
+    AddLinkableParms( parm_vec );
+    for ( int i = 0 ; i < ( int )parm_vec.size() ; i++ )
+    {
+        Parm* p = ParmMgr.FindParm( parm_vec[i] );
+        if ( p )
+        {
+            hash = HashDouble( p->Get(), hash );
+        }
+    }
+
+    for ( int i = 0 ; i < ( int )m_SubSurfVec.size() ; i++ )
+    {
+        hash = HashString( m_SubSurfVec[i]->GetName(), hash );
+        hash = HashInt( m_SubSurfVec[i]->GetType(), hash );
+    }
+
+    hash = HashInt( ( int )m_SurfVec.size(), hash );
+    for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
+    {
+        hash = m_SurfVec[i].GetHash( hash );
+    }
+
+    return hash;
+}
+
 void Geom::ChangeID( string id )
 {
     ParmContainer::ChangeID( id );
@@ -4327,6 +4596,7 @@ void Geom::DelSubSurf( int ind )
     {
         delete m_SubSurfVec[ind];
         m_SubSurfVec.erase( m_SubSurfVec.begin() + ind );
+        MarkDirty( UPDATE_XFORM );
     }
 
     SubSurfaceMgr.ReSuffixGroupNames( GetID() );
@@ -4465,6 +4735,7 @@ FeaStructure* Geom::AddFeaStruct( bool initskin, int surf_index )
 
             m_FeaStructVec.push_back( feastruct );
             m_FeaStructCount++;
+            MarkDirty( UPDATE_XFORM );
         }
     }
 
@@ -4488,6 +4759,7 @@ void Geom::DeleteFeaStruct( int index )
 
     delete m_FeaStructVec[index];
     m_FeaStructVec.erase( m_FeaStructVec.begin() + index );
+    MarkDirty( UPDATE_XFORM );
 }
 
 bool Geom::ValidGeomFeaStructInd( int index )
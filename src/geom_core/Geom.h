@@ -75,6 +75,32 @@ public:
 
 class Vehicle;
 
+//==== Draw Tessellation Of One Main Surface ====//
+// Held in the frame the surface had when it was tessellated.  Symmetric copies
+// and transform-only updates reuse it through a rigid transform.
+class SurfTessCache
+{
+public:
+
+    SurfTessCache();
+
+    void Clear();
+
+    bool m_Valid;
+    bool m_FeatureValid;
+    bool m_FlipNormal;
+
+    Matrix4d m_Mat;
+    Matrix4d m_InvMat;
+
+    vector< vector< vector< vec3d > > > m_Pnts;
+    vector< vector< vector< vec3d > > > m_Norms;
+    vector< vector< vector< double > > > m_UTex;
+    vector< vector< vector< double > > > m_VTex;
+
+    vector< vec3d > m_FeaturePnts;   // Line segment pairs
+};
+
 class GeomGuiDraw
 {
 public:
@@ -204,12 +230,26 @@ public:
     virtual void ParmChanged( Parm* parm_ptr, int type );
     virtual void ForceUpdate();
 
+    //==== Update Stages A Change Reaches ( Bit Flags ) ====//
+    enum { UPDATE_NONE = 0, UPDATE_XFORM = 1, UPDATE_SURF = 2, };
+
+    virtual int GetParmStage( Parm* parm_ptr )
+    {
+        return UPDATE_SURF;
+    }
+    virtual void MarkDirty( int stage )
+    {
+        m_DirtyStage |= stage;
+    }
+    virtual bool IsDirty( bool fullupdate = true );
+
     virtual int CountParents( int count );
     virtual bool IsParentJoint();
 
     virtual void SetParentID( string id )
     {
         m_ParentID = id ;
+        MarkDirty( UPDATE_XFORM );
     }
     virtual string GetParentID()
     {
@@ -252,6 +292,9 @@ protected:
     vector< string > m_ChildIDVec;                      // Children ID
 
     vector< string > m_UpdatedParmVec;
+
+    int m_DirtyStage;                                   // Stages changed since the last update
+    int m_PartialStage;                                 // Stages only seen by a partial update
 };
 
 //==== Geom XForm ====//
@@ -271,6 +314,8 @@ public:
     }
     virtual void ResetScale();
     virtual void AcceptScale();
+
+    virtual int GetParmStage( Parm* parm_ptr );
     virtual void Scale()
     {
         m_Scale = 1;
@@ -350,6 +395,17 @@ public:
 
     virtual void Update( bool fullupdate = true );
     virtual void LoadMainDrawObjs( vector< DrawObj* > & draw_obj_vec );
+
+    virtual int GetParmStage( Parm* parm_ptr );
+    virtual void MarkDirty( int stage );
+    virtual void SetLateUpdateFlag( bool flag );
+
+    // True if UpdateSurf reads the model matrix or the parent, so a move
+    // must rebuild the surface
+    virtual bool SurfDependsOnXForm()
+    {
+        return false;
+    }
     virtual void LoadDrawObjs( vector< DrawObj* > & draw_obj_vec );
 
     virtual void SetColor( int r, int g, int b );
@@ -467,10 +523,14 @@ public:
     virtual void AddLinkableParms( vector< string > & linkable_parm_vec, const string & link_container_id = string() );
     virtual void ChangeID( string id );
 
+    // Hash of everything the tessellation, DegenGeom and CompGeom depend on
+    virtual unsigned long long GetStateHash();
+
     //==== Sub Surface Managment Methods ====//
     virtual void AddSubSurf( SubSurface* sub_surf )
     {
         m_SubSurfVec.push_back( sub_surf );
+        MarkDirty( UPDATE_XFORM );
     }
     virtual SubSurface* AddSubSurf( int type, int surfindex );
     virtual bool ValidSubSurfInd( int ind );
@@ -514,6 +574,11 @@ public:
     IntParm m_TessU;
     LimIntParm m_TessW;
 
+    BoolParm m_AdaptTessFlag;
+    Parm m_AdaptChordTol;
+    Parm m_AdaptAngleTol;
+    IntParm m_AdaptMaxPass;
+
     IntParm m_SymAncestor;
     BoolParm m_SymAncestOriginFlag;
     IntParm m_SymPlanFlag;
@@ -669,6 +734,7 @@ protected:
     void UpdateEndCaps();
     virtual void UpdateFeatureLines();
     virtual void UpdateFlags();
+    virtual void UpdateAdaptTess();
     virtual void UpdateSymmAttach();
     virtual void UpdateChildren( bool fullupdate );
     virtual void UpdateBBox();
@@ -681,11 +747,16 @@ protected:
 
     virtual void CalcTexCoords( int indx, vector< vector< vector< double > > > &utex, vector< vector< vector< double > > > &vtex, const vector< vector< vector< vec3d > > > & pnts );
 
+    void UpdateTessCache( int indx, double tol );
+    void ApplyTessCache( int indx, vector< vector< vector< vec3d > > > &pnts, vector< vector< vector< vec3d > > > &norms );
+
     vector<VspSurf> m_MainSurfVec;
     vector<VspSurf> m_SurfVec;
     vector<int> m_SurfIndxVec;
     vector< vector< int > > m_SurfSymmMap;
     vector< Matrix4d > m_FeaTransMatVec; // Vector of transformation matrixes
+    vector< Matrix4d > m_SurfTransMatVec; // Main surface to m_SurfVec transformation for each surface
+    vector< SurfTessCache > m_TessCacheVec; // Draw tessellation for each main surface
     vector<DrawObj> m_WireShadeDrawObj_vec;
     vector<DrawObj> m_FeatureDrawObj_vec;
     DrawObj m_HighlightDrawObj;
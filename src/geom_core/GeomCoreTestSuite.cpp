@@ -8,6 +8,13 @@
 #include "GeomCoreTestSuite.h"
 #include "MeshGeom.h"
 #include "StlHelper.h"
+#include "FitModelMgr.h"
+#include "VehicleMgr.h"
+#include "ParmMgr.h"
+#include "ResultsMgr.h"
+#include "WingGeom.h"
+
+#include "Tritri.h"
 
 
 //==== Test GeomXForm ====//
@@ -241,6 +248,809 @@ void GeomCoreTestSuite::MeshIOTest()
     veh.CutActiveGeomVec();
 }
 
+//==== Check TMesh BVH Queries Against Brute Force Tri Loops ====//
+void GeomCoreTestSuite::TMeshBvhTest()
+{
+    Vehicle veh;
+    GeomType type;
+    type.m_Type = POD_GEOM_TYPE;
+    type.m_Name = "POD";
+
+    //==== Two Overlapping Pods and One Off To The Side ====//
+    Geom* geom[3];
+    for ( int g = 0 ; g < 3 ; g++ )
+    {
+        geom[g] = veh.FindGeom( veh.AddGeom( type ) );
+        geom[g]->m_TessU.Set( 12 );
+        geom[g]->m_TessW.Set( 13 );
+    }
+    geom[1]->m_XRelLoc.Set( 1.5 );
+    geom[1]->m_ZRelLoc.Set( 0.2 );
+    geom[2]->m_ZRelLoc.Set( 3.0 );
+    veh.Update();
+
+    vector< TMesh* > tmv[3];
+    for ( int g = 0 ; g < 3 ; g++ )
+    {
+        tmv[g] = geom[g]->CreateTMeshVec();
+        TEST_ASSERT( tmv[g].size() > 0 );
+        if ( tmv[g].size() == 0 )
+        {
+            return;
+        }
+        tmv[g][0]->LoadBndBox();
+    }
+    TMesh* mesh_a = tmv[0][0];
+    TMesh* mesh_b = tmv[1][0];
+    TMesh* mesh_c = tmv[2][0];
+
+    //==== Ray Casts From Each Tri Of B Through A, As In DeterIntExt ====//
+    vec3d dir( 1.0, 0.000001, 0.000001 );
+    int num_diff = 0;
+    for ( int i = 0 ; i < ( int )mesh_b->m_TVec.size() ; i++ )
+    {
+        TTri* tri = mesh_b->m_TVec[i];
+        vec3d orig = ( tri->m_N0->m_Pnt + tri->m_N1->m_Pnt + tri->m_N2->m_Pnt ) / 3.0;
+
+        vector< double > bvh_t;
+        mesh_a->m_TBox.RayCast( orig, dir, bvh_t );
+
+        vector< double > brute_t;
+        for ( int j = 0 ; j < ( int )mesh_a->m_TVec.size() ; j++ )
+        {
+            TTri* t = mesh_a->m_TVec[j];
+            double tparm, uparm, vparm;
+            if ( intersect_triangle( orig.v, dir.v, t->m_N0->m_Pnt.v, t->m_N1->m_Pnt.v, t->m_N2->m_Pnt.v,
+                                     &tparm, &uparm, &vparm ) && tparm > 0.0 )
+            {
+                bool dup = false;
+                for ( int k = 0 ; k < ( int )brute_t.size() ; k++ )
+                {
+                    if ( std::abs( tparm - brute_t[k] ) < 0.0000001 )
+                    {
+                        dup = true;
+                    }
+                }
+                if ( !dup )
+                {
+                    brute_t.push_back( tparm );
+                }
+            }
+        }
+
+        if ( bvh_t.size() != brute_t.size() )
+        {
+            num_diff++;
+        }
+    }
+    TEST_ASSERT( num_diff == 0 );
+
+    //==== Tri-Tri Pairs ====//
+    bool brute_ab = false;
+    bool brute_ac = false;
+    double brute_dist = 1.0e12;
+    for ( int i = 0 ; i < ( int )mesh_a->m_TVec.size() ; i++ )
+    {
+        TTri* t0 = mesh_a->m_TVec[i];
+        for ( int j = 0 ; j < ( int )mesh_b->m_TVec.size() ; j++ )
+        {
+            TTri* t1 = mesh_b->m_TVec[j];
+            int coplanarFlag;
+            vec3d e0, e1;
+            if ( tri_tri_intersect_with_isectline( t0->m_N0->m_Pnt.v, t0->m_N1->m_Pnt.v, t0->m_N2->m_Pnt.v,
+                                                   t1->m_N0->m_Pnt.v, t1->m_N1->m_Pnt.v, t1->m_N2->m_Pnt.v,
+                                                   &coplanarFlag, e0.v, e1.v ) && !coplanarFlag )
+            {
+                brute_ab = true;
+            }
+        }
+        for ( int j = 0 ; j < ( int )mesh_c->m_TVec.size() ; j++ )
+        {
+            TTri* t1 = mesh_c->m_TVec[j];
+            int coplanarFlag;
+            vec3d e0, e1;
+            if ( tri_tri_intersect_with_isectline( t0->m_N0->m_Pnt.v, t0->m_N1->m_Pnt.v, t0->m_N2->m_Pnt.v,
+                                                   t1->m_N0->m_Pnt.v, t1->m_N1->m_Pnt.v, t1->m_N2->m_Pnt.v,
+                                                   &coplanarFlag, e0.v, e1.v ) && !coplanarFlag )
+            {
+                brute_ac = true;
+            }
+            double d = tri_tri_min_dist( t0->m_N0->m_Pnt, t0->m_N1->m_Pnt, t0->m_N2->m_Pnt,
+                                         t1->m_N0->m_Pnt, t1->m_N1->m_Pnt, t1->m_N2->m_Pnt );
+            brute_dist = min( brute_dist, d );
+        }
+    }
+    TEST_ASSERT( brute_ab );
+    TEST_ASSERT( !brute_ac );
+    TEST_ASSERT( mesh_a->CheckIntersect( mesh_b ) == brute_ab );
+    TEST_ASSERT( mesh_a->CheckIntersect( mesh_c ) == brute_ac );
+    TEST_ASSERT_DELTA( mesh_a->MinDistance( mesh_c, 1.0e12 ), brute_dist, 1.0e-12 );
+
+    //==== Intersection Edges Only Where Tris Cross ====//
+    mesh_a->Intersect( mesh_b );
+    int num_edges = 0;
+    for ( int i = 0 ; i < ( int )mesh_a->m_TVec.size() ; i++ )
+    {
+        num_edges += ( int )mesh_a->m_TVec[i]->m_ISectEdgeVec.size();
+    }
+    TEST_ASSERT( num_edges > 0 );
+
+    mesh_a->Intersect( mesh_c );
+    int num_edges_c = 0;
+    for ( int i = 0 ; i < ( int )mesh_c->m_TVec.size() ; i++ )
+    {
+        num_edges_c += ( int )mesh_c->m_TVec[i]->m_ISectEdgeVec.size();
+    }
+    TEST_ASSERT( num_edges_c == 0 );
+
+    for ( int g = 0 ; g < 3 ; g++ )
+    {
+        for ( int i = 0 ; i < ( int )tmv[g].size() ; i++ )
+        {
+            delete tmv[g][i];
+        }
+    }
+}
+
+//==== Several Independent Pods And Wings, Then Change An Input On Each ====//
+static void build_update_model( Vehicle & veh, vector< Geom* > & geom_vec )
+{
+    GeomType pod_type( POD_GEOM_TYPE, "POD", true );
+    GeomType wing_type( MS_WING_GEOM_TYPE, "WING", true );
+
+    geom_vec.clear();
+    for ( int g = 0 ; g < 6 ; g++ )
+    {
+        Geom* geom = veh.FindGeom( veh.AddGeom( g % 2 ? wing_type : pod_type ) );
+        geom->m_YRelLoc.Set( 5.0 * g );
+        geom_vec.push_back( geom );
+    }
+    veh.Update();
+
+    for ( int g = 0 ; g < ( int )geom_vec.size() ; g++ )
+    {
+        Geom* geom = geom_vec[g];
+        geom->m_XRelLoc.Set( 0.3 * g );
+        geom->m_ZRelRot.Set( 2.0 * g );
+
+        Parm* p = ParmMgr.FindParm( g % 2 ? geom->FindParm( "TotalSpan", "WingGeom" ) : geom->FindParm( "Length", "Design" ) );
+        if ( p )
+        {
+            p->Set( p->Get() * ( 1.1 + 0.1 * g ) );
+        }
+    }
+}
+
+//==== Parm Values And The Order Parms Changed In, For Each Geom ====//
+static void record_update( vector< Geom* > & geom_vec, int start_cnt, vector< vector< double > > & val_vec,
+                           vector< vector< int > > & order_vec, vector< int > & cnt_vec )
+{
+    val_vec.clear();
+    order_vec.clear();
+    for ( int g = 0 ; g < ( int )geom_vec.size() ; g++ )
+    {
+        vector< string > parm_vec;
+        geom_vec[g]->AddLinkableParms( parm_vec );
+
+        vector< double > vals;
+        vector< pair< int, int > > changed;
+        for ( int i = 0 ; i < ( int )parm_vec.size() ; i++ )
+        {
+            Parm* p = ParmMgr.FindParm( parm_vec[i] );
+            if ( p )
+            {
+                vals.push_back( p->Get() );
+                if ( p->GetChangeCnt() > start_cnt )
+                {
+                    changed.push_back( pair< int, int >( p->GetChangeCnt(), i ) );
+                    cnt_vec.push_back( p->GetChangeCnt() );
+                }
+            }
+        }
+        std::sort( changed.begin(), changed.end() );
+
+        vector< int > order;
+        for ( int i = 0 ; i < ( int )changed.size() ; i++ )
+        {
+            order.push_back( changed[i].second );
+        }
+        val_vec.push_back( vals );
+        order_vec.push_back( order );
+    }
+}
+
+//==== Threaded Update Of Independent Trees Must Match The Serial Update ====//
+void GeomCoreTestSuite::ThreadedUpdateTest()
+{
+    vector< vector< double > > val_vec[2];
+    vector< vector< int > > order_vec[2];
+    vector< int > cnt_vec[2];
+
+    for ( int run = 0 ; run < 2 ; run++ )
+    {
+        Vehicle veh;
+        vector< Geom* > geom_vec;
+        build_update_model( veh, geom_vec );
+
+        veh.SetUpdateThreads( run == 0 ? 1 : 4 );
+
+        int start_cnt = ParmMgr.GetChangeCnt();
+        veh.Update();
+
+        record_update( geom_vec, start_cnt, val_vec[run], order_vec[run], cnt_vec[run] );
+    }
+
+    TEST_ASSERT( val_vec[0] == val_vec[1] );
+    TEST_ASSERT( order_vec[0] == order_vec[1] );
+
+    //==== Every Change Gets Its Own Count ====//
+    TEST_ASSERT( cnt_vec[1].size() > 0 );
+    std::sort( cnt_vec[1].begin(), cnt_vec[1].end() );
+    TEST_ASSERT( std::adjacent_find( cnt_vec[1].begin(), cnt_vec[1].end() ) == cnt_vec[1].end() );
+}
+
+//==== Sample Every Surface Of A Geom On A Fixed U,W Grid ====//
+static void sample_surfs( Geom* geom, vector< vec3d > & pnt_vec )
+{
+    pnt_vec.clear();
+    for ( int s = 0 ; s < geom->GetNumTotalSurfs() ; s++ )
+    {
+        VspSurf* surf = geom->GetSurfPtr( s );
+        for ( int i = 0 ; i <= 8 ; i++ )
+        {
+            for ( int j = 0 ; j <= 8 ; j++ )
+            {
+                pnt_vec.push_back( surf->CompPnt01( 0.125 * i, 0.125 * j ) );
+            }
+        }
+    }
+}
+
+//==== XForm Only Changes Skip The Surface Rebuild But Must Give The Same Surfaces ====//
+void GeomCoreTestSuite::UpdateStageTest()
+{
+    Vehicle veh;
+    GeomType pod_type;
+    pod_type.m_Type = POD_GEOM_TYPE;
+    pod_type.m_Name = "POD";
+
+    //==== Pod With A Symmetric Wing Attached ====//
+    Geom* pod = veh.FindGeom( veh.AddGeom( pod_type ) );
+    veh.SetActiveGeom( pod->GetID() );
+
+    GeomType wing_type( MS_WING_GEOM_TYPE, "WING", true );
+    Geom* wing = veh.FindGeom( veh.AddGeom( wing_type ) );
+    veh.ClearActiveGeom();
+    TEST_ASSERT( wing && wing->GetParentID() == pod->GetID() );
+    if ( !wing )
+    {
+        return;
+    }
+    wing->m_SymPlanFlag.Set( vsp::SYM_XZ );
+    wing->m_ZRelLoc.Set( 0.3 );
+    veh.Update();
+
+    //==== Move The Pod - Both Geoms Only Need New Transforms ====//
+    pod->m_XRelLoc.Set( 1.3 );
+    pod->m_YRelLoc.Set( -0.4 );
+    pod->m_ZRelRot.Set( 12.0 );
+    pod->m_XRelRot.Set( -7.0 );
+
+    veh.ResetUpdateStats();
+    veh.Update();
+    TEST_ASSERT( veh.GetNumSurfUpdates() == 0 );
+    TEST_ASSERT( veh.GetNumXFormUpdates() == 2 );
+
+    vector< vec3d > pod_xform, wing_xform;
+    sample_surfs( pod, pod_xform );
+    sample_surfs( wing, wing_xform );
+
+    //==== Rebuild Everything From Scratch ====//
+    pod->SetLateUpdateFlag( true );
+    wing->SetLateUpdateFlag( true );
+
+    veh.ResetUpdateStats();
+    veh.Update();
+    TEST_ASSERT( veh.GetNumSurfUpdates() == 2 );
+
+    vector< vec3d > pod_full, wing_full;
+    sample_surfs( pod, pod_full );
+    sample_surfs( wing, wing_full );
+
+    TEST_ASSERT( pod_xform.size() == pod_full.size() );
+    TEST_ASSERT( wing_xform.size() == wing_full.size() );
+    TEST_ASSERT( wing->GetNumTotalSurfs() == 2 * wing->GetNumMainSurfs() );
+
+    double max_diff = 0.0;
+    for ( int i = 0 ; i < ( int )pod_xform.size() && i < ( int )pod_full.size() ; i++ )
+    {
+        max_diff = max( max_diff, dist( pod_xform[i], pod_full[i] ) );
+    }
+    for ( int i = 0 ; i < ( int )wing_xform.size() && i < ( int )wing_full.size() ; i++ )
+    {
+        max_diff = max( max_diff, dist( wing_xform[i], wing_full[i] ) );
+    }
+    TEST_ASSERT_DELTA( max_diff, 0.0, 1.0e-10 );
+}
+
+//==== Inside/Outside Of One Tri By Its Own Ray, As DeterIntExt Did Before Batching ====//
+static int ref_int_ext( TTri* tri, TMesh* mesh, bool & degen_flag )
+{
+    vec3d orig = ( tri->m_N0->m_Pnt + tri->m_N1->m_Pnt ) * 0.5;
+    orig = ( orig + tri->m_N2->m_Pnt ) * 0.5;
+    vec3d dir( 1.0, 0.000001, 0.000001 );
+
+    vector< double > hits;
+    degen_flag = false;
+    mesh->m_TBox.RayCast( orig, dir, hits, &degen_flag );
+
+    if ( degen_flag )
+    {
+        return std::abs( mesh->WindingNumber( orig ) ) > 0.5 ? 1 : 0;
+    }
+    return ( int )( hits.size() % 2 );
+}
+
+//==== Batched Classification Must Match A Ray Cast From Every Tri ====//
+void GeomCoreTestSuite::DeterIntExtBatchTest()
+{
+    Vehicle veh;
+    GeomType type;
+    type.m_Type = POD_GEOM_TYPE;
+    type.m_Name = "POD";
+
+    //==== Two Overlapping Pods, Enough Tris For Several Batches ====//
+    Geom* geom[2];
+    for ( int g = 0 ; g < 2 ; g++ )
+    {
+        geom[g] = veh.FindGeom( veh.AddGeom( type ) );
+        geom[g]->m_TessU.Set( 24 );
+        geom[g]->m_TessW.Set( 25 );
+    }
+    geom[1]->m_XRelLoc.Set( 1.5 );
+    geom[1]->m_ZRelLoc.Set( 0.2 );
+    veh.Update();
+
+    vector< TMesh* > tmv[2];
+    for ( int g = 0 ; g < 2 ; g++ )
+    {
+        tmv[g] = geom[g]->CreateTMeshVec();
+        TEST_ASSERT( tmv[g].size() > 0 );
+        if ( tmv[g].size() == 0 )
+        {
+            return;
+        }
+        tmv[g][0]->LoadBndBox();
+    }
+    TMesh* mesh_a = tmv[0][0];
+    TMesh* mesh_b = tmv[1][0];
+
+    mesh_a->Intersect( mesh_b );
+    mesh_a->Split();
+    mesh_b->Split();
+
+    vector< TMesh* > mesh_vec;
+    mesh_vec.push_back( mesh_a );
+    mesh_vec.push_back( mesh_b );
+    mesh_b->DeterIntExtBatch( mesh_vec, TMesh::DETER_INT_EXT, 4 );
+
+    //==== Split Tris Share A Ray Per Region, Each Must Still Agree With Its Own ====//
+    int num_diff = 0;
+    int num_inside = 0;
+    int num_split = 0;
+    for ( int i = 0 ; i < ( int )mesh_b->m_TVec.size() ; i++ )
+    {
+        TTri* tri = mesh_b->m_TVec[i];
+        vector< TTri* > tri_vec = tri->m_SplitVec;
+        if ( tri_vec.size() == 0 )
+        {
+            tri_vec.push_back( tri );
+        }
+        else
+        {
+            num_split++;
+        }
+
+        for ( int s = 0 ; s < ( int )tri_vec.size() ; s++ )
+        {
+            bool degen_flag;
+            int inside = ref_int_ext( tri_vec[s], mesh_a, degen_flag );
+            num_inside += inside;
+            if ( tri_vec[s]->m_InteriorFlag != inside )
+            {
+                num_diff++;
+            }
+        }
+    }
+    TEST_ASSERT( num_split > 0 );
+    TEST_ASSERT( num_inside > 0 );
+    TEST_ASSERT( num_diff == 0 );
+
+    for ( int g = 0 ; g < 2 ; g++ )
+    {
+        for ( int i = 0 ; i < ( int )tmv[g].size() ; i++ )
+        {
+            delete tmv[g][i];
+        }
+    }
+
+    //==== Unit Cube, The x = 1 Face Split Along Its y = z Diagonal ====//
+    vec3d c[8];
+    for ( int k = 0 ; k < 8 ; k++ )
+    {
+        c[k] = vec3d( k & 1, ( k >> 1 ) & 1, ( k >> 2 ) & 1 );
+    }
+    TMesh* cube = new TMesh();
+    cube->AddTri( c[0], c[2], c[3] );       // x = 0
+    cube->AddTri( c[0], c[3], c[1] );
+    cube->AddTri( c[1], c[3], c[7] );       // x = 1
+    cube->AddTri( c[1], c[7], c[5] );
+    cube->AddTri( c[0], c[1], c[5] );       // y = 0
+    cube->AddTri( c[0], c[5], c[4] );
+    cube->AddTri( c[2], c[6], c[7] );       // y = 1
+    cube->AddTri( c[2], c[7], c[3] );
+    cube->AddTri( c[0], c[4], c[6] );       // z = 0
+    cube->AddTri( c[0], c[6], c[2] );
+    cube->AddTri( c[4], c[5], c[7] );       // z = 1
+    cube->AddTri( c[4], c[7], c[6] );
+    cube->LoadBndBox();
+
+    //==== A Tri Whose Ray Starts At ( 0.4, 0.4, 0.4 ) And Lands On That Diagonal ====//
+    TMesh* probe = new TMesh();
+    probe->AddTri( vec3d( 0.2, 0.3, 0.5 ), vec3d( 0.4, 0.5, 0.3 ), vec3d( 0.5, 0.4, 0.4 ) );
+    probe->LoadBndBox();
+
+    mesh_vec.clear();
+    mesh_vec.push_back( cube );
+    mesh_vec.push_back( probe );
+    probe->DeterIntExtBatch( mesh_vec, TMesh::DETER_INT_EXT );
+
+    bool degen_flag;
+    int inside = ref_int_ext( probe->m_TVec[0], cube, degen_flag );
+    TEST_ASSERT( degen_flag );
+    TEST_ASSERT( inside == 1 );
+    TEST_ASSERT( probe->m_TVec[0]->m_InteriorFlag == inside );
+
+    delete cube;
+    delete probe;
+}
+
+//==== Jacobian Columns Found On Threads Must Match The Serial Ones Exactly ====//
+void GeomCoreTestSuite::FitModelJacobianTest()
+{
+    Vehicle* veh = VehicleMgr.GetVehicle();
+    GeomType type;
+    type.m_Type = POD_GEOM_TYPE;
+    type.m_Name = "POD";
+
+    //==== A Moved And Rotated Parent Pod Without Variables ====//
+    Geom* parent = veh->FindGeom( veh->AddGeom( type ) );
+    parent->m_XRelLoc.Set( 2.0 );
+    parent->m_ZRelLoc.Set( -1.5 );
+    parent->m_YRelRot.Set( 15.0 );
+    parent->m_ZRelRot.Set( 30.0 );
+
+    //==== Two Separate Pods And One Attached To The Parent, Each Moved By Its Own Variables ====//
+    vector< string > geom_id_vec;
+    for ( int g = 0 ; g < 3 ; g++ )
+    {
+        if ( g == 2 )
+        {
+            veh->SetActiveGeom( parent->GetID() );
+        }
+        Geom* geom = veh->FindGeom( veh->AddGeom( type ) );
+        veh->ClearActiveGeom();
+        geom->m_YRelLoc.Set( 3.0 * g );
+        geom_id_vec.push_back( geom->GetID() );
+
+        FitModelMgr.AddVar( geom->m_XRelLoc.GetID() );
+        FitModelMgr.AddVar( geom->m_YRelRot.GetID() );
+        FitModelMgr.AddVar( geom->FindParm( "Length", "Design" ) );
+        FitModelMgr.AddVar( geom->FindParm( "FineRatio", "Design" ) );
+    }
+    veh->Update();
+
+    TEST_ASSERT( veh->FindGeom( geom_id_vec[2] )->GetParentID() == parent->GetID() );
+
+    //==== Target Points Near Each Pod ====//
+    for ( int g = 0 ; g < 3 ; g++ )
+    {
+        for ( int i = 0 ; i < 10 ; i++ )
+        {
+            double u = 0.05 + 0.09 * i;
+            double w = 0.1 * i;
+
+            TargetPt* tpt = new TargetPt();
+            tpt->SetMatchGeom( geom_id_vec[g] );
+            tpt->SetPt( veh->FindGeom( geom_id_vec[g] )->GetSurfPtr()->CompPnt01( u, w ) + vec3d( 0.1, 0.05, -0.05 ) );
+            tpt->SetUW( vec2d( u, w ) );
+            tpt->SetUType( TargetPt::FIXED );
+            tpt->SetWType( TargetPt::FIXED );
+            FitModelMgr.AddTargetPt( tpt );
+        }
+    }
+    FitModelMgr.RefineTargetUW();
+
+    vector< double > serial_jac;
+    FitModelMgr.m_NumThreads.Set( 1 );
+    FitModelMgr.CalcJacobian( serial_jac );
+
+    for ( int nthread = 2 ; nthread <= 4 ; nthread++ )
+    {
+        vector< double > thread_jac;
+        FitModelMgr.m_NumThreads.Set( nthread );
+        FitModelMgr.CalcJacobian( thread_jac );
+
+        TEST_ASSERT( thread_jac.size() == serial_jac.size() );
+        TEST_ASSERT( thread_jac == serial_jac );
+    }
+
+    FitModelMgr.m_NumThreads.Set( 1 );
+    FitModelMgr.DelAllTargetPts();
+    FitModelMgr.DelAllVars();
+    geom_id_vec.push_back( parent->GetID() );
+    veh->DeleteGeomVec( geom_id_vec );
+}
+
+//==== Summary Of The DegenGeom Entries Built From One Geom ====//
+static void degen_summary( Vehicle* veh, Geom* geom, int & ndegen, double & max_y, int & npnt, double & ss_u )
+{
+    vector< DegenGeom > dg_vec = veh->GetDegenGeomVec();
+
+    ndegen = 0;
+    max_y = 0.0;
+    npnt = 0;
+    ss_u = 0.0;
+    for ( int i = 0 ; i < ( int )dg_vec.size() ; i++ )
+    {
+        if ( dg_vec[i].getParentGeom() != geom )
+        {
+            continue;
+        }
+        ndegen++;
+        npnt += dg_vec[i].getNumXSecs() * dg_vec[i].getNumPnts();
+
+        DegenSurface ds = dg_vec[i].getDegenSurf();
+        for ( int j = 0 ; j < ( int )ds.x.size() ; j++ )
+        {
+            for ( int k = 0 ; k < ( int )ds.x[j].size() ; k++ )
+            {
+                max_y = max( max_y, std::abs( ds.x[j][k].y() ) );
+            }
+        }
+
+        vector< DegenSubSurf > dss_vec = dg_vec[i].getDegenSubSurfs();
+        for ( int j = 0 ; j < ( int )dss_vec.size() ; j++ )
+        {
+            for ( int k = 0 ; k < ( int )dss_vec[j].u.size() ; k++ )
+            {
+                ss_u += dss_vec[j].u[k];
+            }
+        }
+    }
+}
+
+//==== Mesh ID And Triangle Count Of A Comp_Geom Result ====//
+static void comp_geom_summary( Results* res, string & mesh_id, int & ncomp, int & ntri )
+{
+    mesh_id = string();
+    ncomp = 0;
+    ntri = 0;
+    if ( res )
+    {
+        mesh_id = res->FindPtr( "Mesh_GeomID" )->GetString( 0 );
+        ncomp = res->FindPtr( "Num_Comps" )->GetInt( 0 );
+        ntri = res->FindPtr( "Total_Num_Tris" )->GetInt( 0 );
+    }
+}
+
+void GeomCoreTestSuite::GeomResultsCacheTest()
+{
+    Vehicle* veh = VehicleMgr.GetVehicle();
+    int set = vsp::SET_FIRST_USER;
+
+    //==== A Wing With A Sub Surface And A Pod, Alone In A User Set ====//
+    vector< Geom* > old_vec = veh->FindGeomVec( veh->GetGeomVec( false ) );
+    for ( int i = 0 ; i < ( int )old_vec.size() ; i++ )
+    {
+        old_vec[i]->SetSetFlag( set, false );
+    }
+
+    GeomType wing_type( MS_WING_GEOM_TYPE, "WING", true );
+    WingGeom* wing = dynamic_cast< WingGeom* >( veh->FindGeom( veh->AddGeom( wing_type ) ) );
+    GeomType pod_type( POD_GEOM_TYPE, "POD", true );
+    Geom* pod = veh->FindGeom( veh->AddGeom( pod_type ) );
+    TEST_ASSERT( wing && pod );
+    if ( !wing || !pod )
+    {
+        return;
+    }
+    pod->m_YRelLoc.Set( 10.0 );
+    wing->SetSetFlag( set, true );
+    pod->SetSetFlag( set, true );
+
+    SSRectangle* rect = dynamic_cast< SSRectangle* >( wing->AddSubSurf( vsp::SS_RECTANGLE, 0 ) );
+    TEST_ASSERT( rect );
+    if ( !rect )
+    {
+        return;
+    }
+    veh->Update();
+
+    int ndegen0, npnt0, ndegen, npnt;
+    double max_y0, ss_u0, max_y, ss_u;
+    string mesh_id0, mesh_id;
+    int ncomp0, ntri0, ncomp, ntri;
+
+    veh->CreateDegenGeom( set );
+    TEST_ASSERT( veh->GetDegenMeshTime() > 0 );
+    degen_summary( veh, wing, ndegen0, max_y0, npnt0, ss_u0 );
+    TEST_ASSERT( ndegen0 > 0 );
+    comp_geom_summary( veh->CompGeomResults( set, 0, 1 ), mesh_id0, ncomp0, ntri0 );
+    TEST_ASSERT( ncomp0 == 2 );
+
+    //==== Unchanged Geometry Reuses Both Caches ====//
+    veh->Update();
+    veh->CreateDegenGeom( set );
+    TEST_ASSERT_DELTA( veh->GetDegenMeshTime(), 0.0, 1.0e-12 );
+    degen_summary( veh, wing, ndegen, max_y, npnt, ss_u );
+    TEST_ASSERT( ndegen == ndegen0 && npnt == npnt0 );
+    TEST_ASSERT_DELTA( max_y, max_y0, 1.0e-12 );
+    comp_geom_summary( veh->CompGeomResults( set, 0, 1 ), mesh_id, ncomp, ntri );
+    TEST_ASSERT( mesh_id == mesh_id0 && ntri == ntri0 );
+
+    //==== An XSec Parm Forces A Rebuild With The New Span ====//
+    WingSect* sect = dynamic_cast< WingSect* >( wing->GetXSec( 1 ) );
+    TEST_ASSERT( sect );
+    if ( !sect )
+    {
+        return;
+    }
+    sect->m_Span.Set( sect->m_Span() + 2.0 );
+    veh->Update();
+
+    veh->CreateDegenGeom( set );
+    TEST_ASSERT( veh->GetDegenMeshTime() > 0 );
+    degen_summary( veh, wing, ndegen, max_y, npnt, ss_u );
+    TEST_ASSERT( max_y > max_y0 + 1.0 );
+    comp_geom_summary( veh->CompGeomResults( set, 0, 1 ), mesh_id, ncomp, ntri );
+    TEST_ASSERT( mesh_id != mesh_id0 );
+    max_y0 = max_y;
+    mesh_id0 = mesh_id;
+
+    //==== A Sub Surface Parm Forces A Rebuild With The Moved Sub Surface ====//
+    rect->m_CenterU.Set( rect->m_CenterU() + 0.1 );
+    veh->Update();
+
+    veh->CreateDegenGeom( set );
+    TEST_ASSERT( veh->GetDegenMeshTime() > 0 );
+    degen_summary( veh, wing, ndegen, max_y, npnt, ss_u );
+    TEST_ASSERT( std::abs( ss_u - ss_u0 ) > 1.0e-6 );
+    comp_geom_summary( veh->CompGeomResults( set, 0, 1 ), mesh_id, ncomp, ntri );
+    TEST_ASSERT( mesh_id != mesh_id0 );
+    mesh_id0 = mesh_id;
+    ntri0 = ntri;
+
+    //==== A Tess Parm Forces A Rebuild With More Points ====//
+    wing->m_TessW.Set( wing->m_TessW() + 8 );
+    veh->Update();
+
+    veh->CreateDegenGeom( set );
+    TEST_ASSERT( veh->GetDegenMeshTime() > 0 );
+    degen_summary( veh, wing, ndegen, max_y, npnt, ss_u );
+    TEST_ASSERT( npnt > npnt0 );
+    comp_geom_summary( veh->CompGeomResults( set, 0, 1 ), mesh_id, ncomp, ntri );
+    TEST_ASSERT( mesh_id != mesh_id0 && ntri > ntri0 );
+    mesh_id0 = mesh_id;
+
+    //==== Leaving The Set Invalidates Both Caches ====//
+    pod->SetSetFlag( set, false );
+    veh->Update();
+
+    veh->CreateDegenGeom( set );
+    TEST_ASSERT( veh->GetDegenMeshTime() > 0 );
+    degen_summary( veh, pod, ndegen, max_y, npnt, ss_u );
+    TEST_ASSERT( ndegen == 0 );
+    comp_geom_summary( veh->CompGeomResults( set, 0, 1 ), mesh_id, ncomp, ntri );
+    TEST_ASSERT( mesh_id != mesh_id0 && ncomp == 1 );
+
+    //==== Wype, Through Renew, Clears Both Caches ====//
+    veh->Renew();
+
+    veh->CreateDegenGeom( set );
+    TEST_ASSERT( veh->GetDegenGeomVec().empty() );
+    TEST_ASSERT( veh->CompGeomResults( set, 0, 1 ) == NULL );
+}
+
+//==== Tessellation Points And Tess_Error Of A Geom's First Surface ====//
+static void tess_results( Geom* geom, vector< vec3d > & pnts, int & num_xsec, int & num_pnt, double & err )
+{
+    Results* res = ResultsMgr.CreateResults( "Tess_Test" );
+    geom->CreateGeomResults( res );
+
+    num_xsec = res->FindPtr( "Num_XSecs" )->GetInt( 0 );
+    num_pnt = res->FindPtr( "Num_Pnts_Per_XSec" )->GetInt( 0 );
+    err = res->FindPtr( "Tess_Error" )->GetDouble( 0 );
+
+    pnts.clear();
+    for ( int i = 0 ; i < num_xsec ; i++ )
+    {
+        const vector< vec3d > & xsec = res->FindPtr( "XSec_Pnts", i )->GetVec3dData();
+        pnts.insert( pnts.end(), xsec.begin(), xsec.end() );
+    }
+
+    ResultsMgr.DeleteResult( res->GetID() );
+}
+
+void GeomCoreTestSuite::AdaptTessTest()
+{
+    Vehicle veh;
+    GeomType pod_type;
+    pod_type.m_Type = POD_GEOM_TYPE;
+    pod_type.m_Name = "POD";
+
+    Geom* pod = veh.FindGeom( veh.AddGeom( pod_type ) );
+    veh.Update();
+
+    vector< vec3d > uniform_pnts;
+    int uniform_nxsec, uniform_npnt;
+    double uniform_err;
+    tess_results( pod, uniform_pnts, uniform_nxsec, uniform_npnt, uniform_err );
+
+    //==== Adaptive Settings Without The Flag Leave The Uniform Grid Alone ====//
+    pod->m_AdaptChordTol.Set( 1.0e-4 );
+    pod->m_AdaptAngleTol.Set( 1.0 );
+    pod->m_AdaptMaxPass.Set( 10 );
+    veh.Update();
+
+    vector< vec3d > off_pnts;
+    int off_nxsec, off_npnt;
+    double off_err;
+    tess_results( pod, off_pnts, off_nxsec, off_npnt, off_err );
+
+    TEST_ASSERT( off_nxsec == uniform_nxsec );
+    TEST_ASSERT( off_npnt == uniform_npnt );
+    TEST_ASSERT( off_pnts.size() == uniform_pnts.size() );
+
+    double max_diff = 0.0;
+    for ( int i = 0 ; i < ( int )off_pnts.size() && i < ( int )uniform_pnts.size() ; i++ )
+    {
+        max_diff = max( max_diff, dist( off_pnts[i], uniform_pnts[i] ) );
+    }
+    TEST_ASSERT_DELTA( max_diff, 0.0, 1.0e-12 );
+    TEST_ASSERT_DELTA( off_err, uniform_err, 1.0e-12 );
+
+    //==== Refinement Ends Below The Requested Tolerance ====//
+    BndBox bb;
+    pod->GetSurfPtr( 0 )->GetBoundingBox( bb );
+    double tol = 1.0e-3;
+
+    pod->m_AdaptTessFlag.Set( true );
+    pod->m_AdaptChordTol.Set( tol );
+    pod->m_AdaptAngleTol.Set( 90.0 );
+    veh.Update();
+
+    vector< vec3d > adapt_pnts;
+    int adapt_nxsec, adapt_npnt;
+    double adapt_err;
+    tess_results( pod, adapt_pnts, adapt_nxsec, adapt_npnt, adapt_err );
+
+    TEST_ASSERT( uniform_err > tol * bb.DiagDist() );
+    TEST_ASSERT( adapt_err < tol * bb.DiagDist() );
+    TEST_ASSERT( adapt_nxsec > uniform_nxsec );
+    TEST_ASSERT( adapt_npnt > uniform_npnt );
+
+    //==== An Unreachable Tolerance Stops At The Curve Limit ====//
+    pod->m_AdaptChordTol.Set( 1.0e-6 );
+    pod->m_AdaptAngleTol.Set( 0.1 );
+    veh.Update();
+
+    tess_results( pod, adapt_pnts, adapt_nxsec, adapt_npnt, adapt_err );
+
+    TEST_ASSERT( adapt_nxsec <= ADAPT_TESS_MAX_CURVES );
+    TEST_ASSERT( adapt_npnt <= ADAPT_TESS_MAX_CURVES );
+}
+
 void GeomCoreTestSuite::CompareMeshes( Vehicle & veh, string mesh_a, string mesh_b )
 {
     MeshGeom* mesh_1 = ( MeshGeom* )veh.FindGeom( mesh_a );
@@ -27,6 +27,13 @@ public:
         TEST_ADD( GeomCoreTestSuite::PodTest )
         TEST_ADD( GeomCoreTestSuite::XmlTest )
         TEST_ADD( GeomCoreTestSuite::MeshIOTest )
+        TEST_ADD( GeomCoreTestSuite::UpdateStageTest )
+        TEST_ADD( GeomCoreTestSuite::ThreadedUpdateTest )
+        TEST_ADD( GeomCoreTestSuite::TMeshBvhTest )
+        TEST_ADD( GeomCoreTestSuite::DeterIntExtBatchTest )
+        TEST_ADD( GeomCoreTestSuite::FitModelJacobianTest )
+        TEST_ADD( GeomCoreTestSuite::GeomResultsCacheTest )
+        TEST_ADD( GeomCoreTestSuite::AdaptTessTest )
     }
 
 private:
@@ -36,6 +43,13 @@ private:
     void PodTest();
     void XmlTest();
     void MeshIOTest();
+    void UpdateStageTest();
+    void ThreadedUpdateTest();
+    void TMeshBvhTest();
+    void DeterIntExtBatchTest();
+    void FitModelJacobianTest();
+    void GeomResultsCacheTest();
+    void AdaptTessTest();
     void CompareMeshes( Vehicle & veh, string mesh_a, string mesh_b );
     void CompareVec3ds( const vec3d & v1, const vec3d & v2, const char * msg = NULL );
 
@@ -400,6 +400,14 @@ double PointSimpleSource::GetTargetLen( double base_len, vec3d &  pos, const str
     return ( m_Len + fract * ( base_len - m_Len  ) );
 }
 
+bool PointSimpleSource::GetInfluenceBox( BndBox & box )
+{
+    box.Reset();
+    box.Update( m_Loc );
+    box.Expand( m_Rad );
+    return true;
+}
+
 void PointSimpleSource::Update( Geom* geomPtr )
 {
     m_Loc = geomPtr->CompPnt01(m_SurfIndx, m_ULoc, m_WLoc);
@@ -573,6 +581,12 @@ double LineSimpleSource::GetTargetLen( double base_len, vec3d & pos, const strin
     return retlen;
 }
 
+bool LineSimpleSource::GetInfluenceBox( BndBox & box )
+{
+    box = m_Box;
+    return true;
+}
+
 void LineSimpleSource::Update( Geom* geomPtr )
 {
     vec3d p1 = geomPtr->CompPnt01(m_SurfIndx, m_ULoc1, m_WLoc1);
@@ -748,6 +762,12 @@ double BoxSimpleSource::GetTargetLen( double base_len, vec3d & pos, const string
     return ( m_Len + max_fract * ( base_len - m_Len  ) );
 }
 
+bool BoxSimpleSource::GetInfluenceBox( BndBox & box )
+{
+    box = m_Box;
+    return true;
+}
+
 void BoxSimpleSource::Update( Geom* geomPtr )
 {
     BndBox box;
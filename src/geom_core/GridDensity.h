@@ -185,6 +185,12 @@ public:
 
     virtual double GetTargetLen( double base_len, vec3d &  pos, const string & geomid, const int & surfindx, const double & u, const double &w ) = 0;
 
+    // Box outside of which GetTargetLen returns base_len, false if unbounded
+    virtual bool GetInfluenceBox( BndBox & box )
+    {
+        return false;
+    }
+
     virtual void Draw()                                             {}
 
     virtual void Update( Geom* geomPtr )                            {}
@@ -218,6 +224,7 @@ public:
     virtual ~PointSimpleSource()      {}
 
     virtual double GetTargetLen( double base_len, vec3d &  pos, const string & geomid, const int & surfindx, const double & u, const double &w );
+    virtual bool GetInfluenceBox( BndBox & box );
 
     virtual void Update( Geom* geomPtr );
 
@@ -250,6 +257,7 @@ public:
     virtual void AdjustLen( double val );
 
     virtual double GetTargetLen( double base_len, vec3d &  pos, const string & geomid, const int & surfindx, const double & u, const double &w );
+    virtual bool GetInfluenceBox( BndBox & box );
 
     virtual void Update( Geom* geomPtr );
 
@@ -296,6 +304,7 @@ public:
     void ComputeCullPnts();
 
     virtual double GetTargetLen( double base_len, vec3d &  pos, const string & geomid, const int & surfindx, const double & u, const double &w );
+    virtual bool GetInfluenceBox( BndBox & box );
 
     void Update( Geom* geomPtr );
 
@@ -25,6 +25,11 @@ public:
 
     virtual void UpdateSurf();
 
+    virtual bool SurfDependsOnXForm()
+    {
+        return true;
+    }
+
     virtual void UpdateMotionFlagsLimits();
 
     virtual void UpdateDrawObj();
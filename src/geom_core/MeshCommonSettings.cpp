@@ -268,6 +268,9 @@ CfdMeshSettings::CfdMeshSettings() : MeshCommonSettings()
 
     m_ExportRawFlag.Init( "ExportRawFlag", "ExportCFD", this, false, 0, 1 );
 
+    m_NumThreads.Init( "NumThreads", "Global", this, 0, 0, 1024 );
+    m_NumThreads.SetDescript( "Number of threads for meshing, 0 uses one per core" );
+
     InitCommonParms();
     m_DrawBorderFlag = false;
     m_DrawIsectFlag = false;
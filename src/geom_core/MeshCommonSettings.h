@@ -219,6 +219,8 @@ public:
     BoolParm m_ExportFileFlags[vsp::CFD_NUM_FILE_NAMES];
     BoolParm m_XYZIntCurveFlag;
 
+    IntParm m_NumThreads;
+
 protected:
 
     // These file names do not get written to file.  They are reset each time
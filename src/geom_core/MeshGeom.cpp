@@ -21,6 +21,7 @@
 #include "PntNodeMerge.h"
 
 #include "StringUtil.h"
+#include "Util.h"
 #include "StlHelper.h"
 
 #include "SubSurfaceMgr.h"
@@ -3475,13 +3476,17 @@ void MeshGeom::MassSliceX( int numSlices, bool writefile )
     }
 }
 
-void MeshGeom::degenGeomMassSliceX( vector< DegenGeom > &degenGeom )
+//==== intersectFlag false - Meshes Already Merged, Intersected and Split by degenGeomIntersectTrim ====//
+void MeshGeom::degenGeomMassSliceX( vector< DegenGeom > &degenGeom, bool intersectFlag )
 {
     int i, j, s, numSlices = 250;
 
     //==== Check For Open Meshes and Merge or Delete Them ====//
-    MeshInfo info;
-    MergeRemoveOpenMeshes( &info );
+    if ( intersectFlag )
+    {
+        MeshInfo info;
+        MergeRemoveOpenMeshes( &info );
+    }
 
     //==== Augment ID with index to make symmetric copies unique. ====//
     for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
@@ -3570,26 +3575,28 @@ void MeshGeom::degenGeomMassSliceX( vector< DegenGeom > &degenGeom )
         tm->MassDeterIntExt( m_TMeshVec );
     }
 
-
-    //==== Intersect All Mesh Geoms ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+    if ( intersectFlag )
     {
-        for ( j = i + 1 ; j < ( int )m_TMeshVec.size() ; j++ )
+        //==== Intersect All Mesh Geoms ====//
+        for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
         {
-            m_TMeshVec[i]->Intersect( m_TMeshVec[j] );
+            for ( j = i + 1 ; j < ( int )m_TMeshVec.size() ; j++ )
+            {
+                m_TMeshVec[i]->Intersect( m_TMeshVec[j] );
+            }
         }
-    }
 
-    //==== Split Intersected Tri in Mesh ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        m_TMeshVec[i]->Split();
-    }
+        //==== Split Intersected Tri in Mesh ====//
+        for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+        {
+            m_TMeshVec[i]->Split();
+        }
 
-    //==== Determine Which Triangle Are Interior/Exterior ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        m_TMeshVec[i]->DeterIntExt( m_TMeshVec );
+        //==== Determine Which Triangle Are Interior/Exterior ====//
+        for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+        {
+            m_TMeshVec[i]->DeterIntExt( m_TMeshVec );
+        }
     }
 
     //==== Do Shell Calcs ====//
@@ -4116,6 +4123,31 @@ void MeshGeom::AddHalfBox()
 
 }
 
+//==== Mesh Data Does Not Live In Parms, So Fold In The Triangles ====//
+unsigned long long MeshGeom::GetStateHash()
+{
+    unsigned long long hash = Geom::GetStateHash();
+
+    for ( int i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+    {
+        TMesh* tm = m_TMeshVec[i];
+        hash = HashInt( ( int )tm->m_TVec.size(), hash );
+        for ( int t = 0 ; t < ( int )tm->m_TVec.size() ; t++ )
+        {
+            TTri* tri = tm->m_TVec[t];
+            TNode* nodes[3] = { tri->m_N0, tri->m_N1, tri->m_N2 };
+            for ( int n = 0 ; n < 3 ; n++ )
+            {
+                hash = HashDouble( nodes[n]->m_Pnt.x(), hash );
+                hash = HashDouble( nodes[n]->m_Pnt.y(), hash );
+                hash = HashDouble( nodes[n]->m_Pnt.z(), hash );
+            }
+        }
+    }
+
+    return hash;
+}
+
 vector<TMesh*> MeshGeom::CreateTMeshVec()
 {
     vector<TMesh*> retTMeshVec;
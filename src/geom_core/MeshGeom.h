@@ -144,7 +144,7 @@ public:
     virtual void IntersectTrim( int halfFlag = 0, int intSubsFlag = 1 );
     virtual void degenGeomIntersectTrim( vector< DegenGeom > &degenGeom );
     virtual void MassSliceX( int numSlice, bool writefile = true );
-    virtual void degenGeomMassSliceX( vector< DegenGeom > &degenGeom );
+    virtual void degenGeomMassSliceX( vector< DegenGeom > &degenGeom, bool intersectFlag = true );
     virtual void AreaSlice( int numSlices, vec3d norm, bool autoBounds, double start = 0, double end = 0 );
 
     virtual void WaveStartEnd( const double &sliceAngle, const vec3d &center );
@@ -176,6 +176,7 @@ public:
         return 0;
     }
     virtual vector< TMesh* > CreateTMeshVec();
+    virtual unsigned long long GetStateHash();
     virtual void FlattenTMeshVec();
     virtual void FlattenSliceVec();
     virtual Matrix4d GetTotalTransMat();
@@ -404,9 +404,9 @@ void ParasiteDragMgrSingleton::SetupFullCalculation()
 
         vector < string > geomIDVec = veh->GetGeomSet( m_SetChoice() );
 
+        // Both reuse their last results when no geom in the set has changed
         veh->CreateDegenGeom( m_SetChoice() );
-        string meshID = veh->CompGeomAndFlatten( m_SetChoice(), 0 );
-        veh->DeleteGeom( meshID );
+        veh->CompGeomResults( m_SetChoice(), 0 );
 
         // Restore set visibility. At this point, all geoms in the set will only be in the 
         //  Not_Shown set. We want the Parasite Drag table to contain the same geoms before 
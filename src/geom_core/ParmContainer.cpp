@@ -96,6 +96,16 @@ ParmContainer* ParmContainer::GetParentContainerPtr()
     return ParmMgr.FindParmContainer( m_ParentContainer );
 }
 
+//==== Mark Parent Geom For Update ====//
+void ParmContainer::MarkParentGeomDirty( const string & geom_id, int stage )
+{
+    GeomBase* geom = dynamic_cast< GeomBase* >( ParmMgr.FindParmContainer( geom_id ) );
+    if ( geom )
+    {
+        geom->MarkDirty( stage );
+    }
+}
+
 //==== Create A Unique ID  =====//
 string ParmContainer::GenerateID()
 {
@@ -86,6 +86,9 @@ protected:
     //==== Methods ====//
     virtual string GenerateID();
 
+    //==== Mark Geom For Update When This Container Changes It Without A Parm ====//
+    void MarkParentGeomDirty( const string & geom_id, int stage );
+
     virtual void LoadGroupParmVec( vector< string > & parm_vec );
     virtual void LoadGroupParmVec( vector< string > & parm_vec, bool displaynames );
 
@@ -184,7 +184,7 @@ string ParmMgrSingleton::GenerateID( int length )
         srand( ( unsigned int )time( NULL ) );
     }
 
-    static char str[256];
+    char str[256];
     for ( int i = 0 ; i < length ; i++ )
     {
         str[i] = ( char )( ( rand() % 26 ) + 65 );
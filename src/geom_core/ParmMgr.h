@@ -20,6 +20,7 @@
 #include <map>
 #include <unordered_map>
 #include <stack>
+#include <atomic>
 
 using std::string;
 using std::unordered_map;
@@ -45,8 +46,9 @@ private:
     unordered_map< string, string > m_IDRemap;                      // oldID->newID Map
     string m_LastReset;
 
-    int m_NumParmChanges;
-    int m_ChangeCnt;
+    //==== Parms Are Set From The Threaded Geom Update ====//
+    std::atomic< int > m_NumParmChanges;
+    std::atomic< int > m_ChangeCnt;
 
     string RemapID( const string & oldID, const string & suggestID, int size );
 
@@ -79,7 +81,7 @@ public:
     Parm* GetActiveParm()                   { return FindParm( m_ActiveParmID ); }
     int GetNumParmChanges()                 { return m_NumParmChanges; }
     void IncNumParmChanges()                { m_NumParmChanges++; }
-    int GetChangeCnt()                      { m_ChangeCnt++; return m_ChangeCnt; }
+    int GetChangeCnt()                      { return ++m_ChangeCnt; }
 
     Parm* CreateParm( int type );
 
@@ -815,6 +815,8 @@ void ScriptMgrSingleton::RegisterEnums( asIScriptEngine* se )
     assert( r >= 0 );
     r = se->RegisterEnumValue( "COMPUTATION_FILE_TYPE", "DEGEN_GEOM_M_TYPE", DEGEN_GEOM_M_TYPE );
     assert( r >= 0 );
+    r = se->RegisterEnumValue( "COMPUTATION_FILE_TYPE", "DEGEN_GEOM_BIN_TYPE", DEGEN_GEOM_BIN_TYPE );
+    assert( r >= 0 );
     r = se->RegisterEnumValue( "COMPUTATION_FILE_TYPE", "CFD_STL_TYPE", CFD_STL_TYPE );
     assert( r >= 0 );
     r = se->RegisterEnumValue( "COMPUTATION_FILE_TYPE", "CFD_POLY_TYPE", CFD_POLY_TYPE );
@@ -902,6 +904,8 @@ void ScriptMgrSingleton::RegisterEnums( asIScriptEngine* se )
     assert( r >= 0 );
     r = se->RegisterEnumValue( "CFD_CONTROL_TYPE", "CFD_SRF_XYZ_FLAG", CFD_SRF_XYZ_FLAG );
     assert( r >= 0 );
+    r = se->RegisterEnumValue( "CFD_CONTROL_TYPE", "CFD_NUM_THREADS", CFD_NUM_THREADS );
+    assert( r >= 0 );
 
     r = se->RegisterEnum( "CFD_MESH_SOURCE_TYPE" );
     assert( r >= 0 );
@@ -1804,6 +1808,10 @@ void ScriptMgrSingleton::RegisterAPI( asIScriptEngine* se )
     //==== Vehicle Functions ====//
     r = se->RegisterGlobalFunction( "void Update()", asFUNCTION( vsp::Update ), asCALL_CDECL );
     assert( r >= 0 );
+    r = se->RegisterGlobalFunction( "void ResetUpdateStats()", asFUNCTION( vsp::ResetUpdateStats ), asCALL_CDECL );
+    assert( r >= 0 );
+    r = se->RegisterGlobalFunction( "string GetUpdateStats()", asFUNCTION( vsp::GetUpdateStats ), asCALL_CDECL );
+    assert( r >= 0 );
     r = se->RegisterGlobalFunction( "void VSPExit( int error_code )", asFUNCTION( vsp::VSPExit ), asCALL_CDECL );
     assert( r >= 0 );
     r = se->RegisterGlobalFunction( "void ClearVSPModel()", asFUNCTION( vsp::ClearVSPModel ), asCALL_CDECL );
@@ -1855,6 +1863,8 @@ void ScriptMgrSingleton::RegisterAPI( asIScriptEngine* se )
     assert( r >= 0 );
     r = se->RegisterGlobalFunction( "void ComputeDegenGeom( int set, int file_type )", asFUNCTION( vsp::ComputeDegenGeom ), asCALL_CDECL );
     assert( r >= 0 );
+    r = se->RegisterGlobalFunction( "string ReadDegenGeomBin( const string & in file_name )", asFUNCTION( vsp::ReadDegenGeomBin ), asCALL_CDECL );
+    assert( r >= 0 );
     r = se->RegisterGlobalFunction( "void ComputeCFDMesh( int set, int file_type )", asFUNCTION( vsp::ComputeCFDMesh ), asCALL_CDECL );
     assert( r >= 0 );
     r = se->RegisterGlobalFunction( "void SetCFDMeshVal( int type, double val )", asFUNCTION( vsp::SetCFDMeshVal ), asCALL_CDECL );
@@ -2303,6 +2313,8 @@ void ScriptMgrSingleton::RegisterAPI( asIScriptEngine* se )
     assert( r >= 0 );
     r = se->RegisterGlobalFunction( "void ProjVecPnt01(const string & in geom_id, int & in surf_indx, array<vec3d>@ pts, array<double>@ us, array<double>@ ws, array<double>@ ds )", asMETHOD( ScriptMgrSingleton, ProjVecPnt01 ), asCALL_THISCALL_ASGLOBAL, &ScriptMgr );
     assert( r >= 0 );
+    r = se->RegisterGlobalFunction( "void ProjVecPnt01I(const string & in geom_id, array<vec3d>@ pts, array<int>@ surf_indxs, array<double>@ us, array<double>@ ws, array<double>@ ds )", asMETHOD( ScriptMgrSingleton, ProjVecPnt01I ), asCALL_THISCALL_ASGLOBAL, &ScriptMgr );
+    assert( r >= 0 );
     r = se->RegisterGlobalFunction( "void ProjVecPnt01Guess(const string & in geom_id, int & in surf_indx, array<vec3d>@ pts, array<double>@ u0s, array<double>@ w0s, array<double>@ us, array<double>@ ws, array<double>@ ds )", asMETHOD( ScriptMgrSingleton, ProjVecPnt01Guess ), asCALL_THISCALL_ASGLOBAL, &ScriptMgr );
     assert( r >= 0 );
 
@@ -2473,6 +2485,15 @@ void ScriptMgrSingleton::FillDoubleArray( vector < double > & in, CScriptArray*
     }
 }
 
+void ScriptMgrSingleton::FillIntArray( vector < int > & in, CScriptArray* out )
+{
+    out->Resize( in.size() );
+    for ( int i = 0 ; i < ( int )in.size() ; i++ )
+    {
+        out->SetValue( i, &in[i] );
+    }
+}
+
 //==== Wrappers For API Functions That Return Vectors ====//
 CScriptArray* ScriptMgrSingleton::GetGeomTypes()
 {
@@ -3091,6 +3112,29 @@ void ScriptMgrSingleton::ProjVecPnt01(const string &geom_id, int &surf_indx, CSc
     FillDoubleArray( out_ds, ds );
 }
 
+void ScriptMgrSingleton::ProjVecPnt01I(const string &geom_id, CScriptArray* pts, CScriptArray* surf_indxs, CScriptArray* us, CScriptArray* ws, CScriptArray* ds )
+{
+    vector < vec3d > in_pts;
+
+    in_pts.resize( pts->GetSize() );
+    for ( int i = 0 ; i < ( int )pts->GetSize() ; i++ )
+    {
+        in_pts[i] = * ( vec3d* )( pts->At( i ) );
+    }
+
+    vector < int > out_surf_indxs;
+    vector < double > out_us;
+    vector < double > out_ws;
+    vector < double > out_ds;
+
+    vsp::ProjVecPnt01I( geom_id, in_pts, out_surf_indxs, out_us, out_ws, out_ds );
+
+    FillIntArray( out_surf_indxs, surf_indxs );
+    FillDoubleArray( out_us, us );
+    FillDoubleArray( out_ws, ws );
+    FillDoubleArray( out_ds, ds );
+}
+
 void ScriptMgrSingleton::ProjVecPnt01Guess(const string &geom_id, int &surf_indx, CScriptArray* pts, CScriptArray* u0s, CScriptArray* w0s, CScriptArray* us, CScriptArray* ws, CScriptArray* ds )
 {
     vector < vec3d > in_pts;
@@ -82,6 +82,7 @@ public:
     CScriptArray* GetProxyDoubleMatArray();
 
     void FillDoubleArray( vector < double > & in, CScriptArray* out );
+    void FillIntArray( vector < int > & in, CScriptArray* out );
 
     //==== Common Types =====//
     asITypeInfo* m_IntArrayType;
@@ -229,6 +230,7 @@ private:
     CScriptArray* CompVecNorm01(const string &geom_id, const int &surf_indx, CScriptArray* us, CScriptArray* ws);
     void CompVecCurvature01(const string &geom_id, const int &surf_indx, CScriptArray* us, CScriptArray* ws, CScriptArray* k1s, CScriptArray* k2s, CScriptArray* kas, CScriptArray* kgs);
     void ProjVecPnt01(const string &geom_id, int &surf_indx, CScriptArray* pts, CScriptArray* us, CScriptArray* ws, CScriptArray* ds );
+    void ProjVecPnt01I(const string &geom_id, CScriptArray* pts, CScriptArray* surf_indxs, CScriptArray* us, CScriptArray* ws, CScriptArray* ds );
     void ProjVecPnt01Guess(const string &geom_id, int &surf_indx, CScriptArray* pts, CScriptArray* u0s, CScriptArray* w0s, CScriptArray* us, CScriptArray* ws, CScriptArray* ds );
     void GetUWTess01(const string &geom_id, int &surf_indx, CScriptArray* us, CScriptArray* ws );
 
@@ -79,6 +79,9 @@ void SubSurface::ParmChanged( Parm* parm_ptr, int type )
     if ( type == Parm::SET )
     {
         m_LateUpdateFlag = true;
+
+        //==== Parent Geom Updates Sub-Surfaces In Its XForm Stage ====//
+        MarkParentGeomDirty( m_CompID, GeomBase::UPDATE_XFORM );
         return;
     }
 
@@ -25,6 +25,9 @@
 #include "Geom.h"
 #include "SubSurfaceMgr.h"
 #include "PntNodeMerge.h"
+#include "ThreadPool.h"
+
+#include <cfloat>
 
 
 //===============================================//
@@ -755,149 +758,273 @@ void TMesh::Split()
 
 void TMesh::DeterIntExt( vector< TMesh* >& meshVec )
 {
-    for ( int t = 0 ; t < ( int )m_TVec.size() ; t++ )
+    DeterIntExtBatch( meshVec, DETER_INT_EXT );
+}
+
+//==== Reset Tri Before Testing It Against Each Mesh ====//
+static void int_ext_init( TTri* tri, int mode )
+{
+    tri->m_InteriorFlag = ( mode == TMesh::MASS_DETER_INT_EXT ) ? 1 : 0;
+}
+
+//==== Tri Is Inside mesh - Returns True If No Other Mesh Can Change The Result ====//
+static bool int_ext_inside( TTri* tri, TMesh* mesh, int mode, int & prior )
+{
+    if ( mode == TMesh::DETER_INT_EXT )
     {
-        TTri* tri = m_TVec[t];
+        tri->m_InteriorFlag = 1;
+        return true;
+    }
 
-        //==== Do Interior Tris ====//
-        if ( tri->m_SplitVec.size() )
+    if ( mesh->m_MassPrior > prior )
+    {
+        if ( mode == TMesh::MASS_DETER_INT_EXT )
         {
-            tri->m_InteriorFlag = 1;
-            for ( int s = 0 ; s < ( int )tri->m_SplitVec.size() ; s++ )
-            {
-                DeterIntExtTri( tri->m_SplitVec[s], meshVec );
-            }
+            tri->m_InteriorFlag = 0;
+            tri->m_Density = mesh->m_Density;
         }
         else
         {
-            DeterIntExtTri( tri, meshVec );
+            tri->m_InteriorFlag = 1;
         }
+        tri->m_ID = mesh->m_PtrID;
+        prior = mesh->m_MassPrior;
     }
+    return false;
 }
 
-void TMesh::DeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec )
+//==== Copy Result To A Tri In The Same Region ====//
+static void int_ext_copy( TTri* tri, TTri* rep, int mode, int prior )
+{
+    tri->m_InteriorFlag = rep->m_InteriorFlag;
+    if ( mode != TMesh::DETER_INT_EXT && prior >= 0 )
+    {
+        tri->m_ID = rep->m_ID;
+        if ( mode == TMesh::MASS_DETER_INT_EXT )
+        {
+            tri->m_Density = rep->m_Density;
+        }
+    }
+}
+
+//==== Ray Origin Used For Each Tri ====//
+static vec3d int_ext_orig( TTri* tri )
 {
     vec3d orig = ( tri->m_N0->m_Pnt + tri->m_N1->m_Pnt ) * 0.5;
     orig = ( orig + tri->m_N2->m_Pnt ) * 0.5;
-    tri->m_InteriorFlag = 0;
-
-    vec3d dir( 1.0, 0.000001, 0.000001 );
+    return orig;
+}
 
-    for ( int m = 0 ; m < ( int )meshVec.size() ; m++ )
+static int int_ext_find( vector< int > & region, int i )
+{
+    while ( region[i] != i )
     {
-        if ( meshVec[m] != this )
-        {
-            vector<double > tParmVec;
-            meshVec[m]->m_TBox.RayCast( orig, dir, tParmVec );
-            if ( tParmVec.size() % 2 )
-            {
-                tri->m_InteriorFlag = 1;
-                return ;
-            }
-        }
+        region[i] = region[ region[i] ];
+        i = region[i];
     }
+    return i;
 }
 
-void TMesh::MassDeterIntExt( vector< TMesh* >& meshVec )
+//==== Group Split Tris Into Regions Not Separated By Any Split Edge - region[i] Is The Lowest Index In Region ====//
+static void int_ext_split_regions( TTri* tri, vector< int > & region )
 {
-    for ( int t = 0 ; t < ( int )m_TVec.size() ; t++ )
+    int i, k;
+    vector< TTri* > & svec = tri->m_SplitVec;
+    int num_split = ( int )svec.size();
+
+    region.resize( num_split );
+    for ( i = 0 ; i < num_split ; i++ )
     {
-        TTri* tri = m_TVec[t];
+        region[i] = i;
+    }
 
-        //==== Do Interior Tris ====//
-        if ( tri->m_SplitVec.size() )
+    double len = max( max( dist( tri->m_N0->m_Pnt, tri->m_N1->m_Pnt ), dist( tri->m_N1->m_Pnt, tri->m_N2->m_Pnt ) ),
+                      dist( tri->m_N2->m_Pnt, tri->m_N0->m_Pnt ) );
+    double tol = 1.0e-6 * len;
+
+    map< pair< TNode*, TNode* >, int > open_edge_map;
+    for ( i = 0 ; i < num_split ; i++ )
+    {
+        TNode* nodes[3] = { svec[i]->m_N0, svec[i]->m_N1, svec[i]->m_N2 };
+        for ( k = 0 ; k < 3 ; k++ )
         {
-            tri->m_InteriorFlag = 1;
-            for ( int s = 0 ; s < ( int )tri->m_SplitVec.size() ; s++ )
+            TNode* n0 = min( nodes[k], nodes[ ( k + 1 ) % 3 ] );
+            TNode* n1 = max( nodes[k], nodes[ ( k + 1 ) % 3 ] );
+
+            //==== Edges Along Any Split Edge Separate Regions ====//
+            bool split_edge = false;
+            for ( int e = 0 ; e < ( int )tri->m_EVec.size() && !split_edge ; e++ )
+            {
+                TEdge* edge = tri->m_EVec[e];
+                if ( ( edge->m_N0 == n0 && edge->m_N1 == n1 ) || ( edge->m_N0 == n1 && edge->m_N1 == n0 ) )
+                {
+                    split_edge = true;
+                }
+                else
+                {
+                    double t;
+                    split_edge = pointSegDistSquared( n0->m_Pnt, edge->m_N0->m_Pnt, edge->m_N1->m_Pnt, &t ) <= tol * tol &&
+                                 pointSegDistSquared( n1->m_Pnt, edge->m_N0->m_Pnt, edge->m_N1->m_Pnt, &t ) <= tol * tol;
+                }
+            }
+            if ( split_edge )
             {
-                MassDeterIntExtTri( tri->m_SplitVec[s], meshVec );
+                continue;
+            }
+
+            pair< TNode*, TNode* > key( n0, n1 );
+            map< pair< TNode*, TNode* >, int >::iterator it = open_edge_map.find( key );
+            if ( it == open_edge_map.end() )
+            {
+                open_edge_map[ key ] = i;
+            }
+            else
+            {
+                int r0 = int_ext_find( region, i );
+                int r1 = int_ext_find( region, it->second );
+                region[ max( r0, r1 ) ] = min( r0, r1 );
             }
-        }
-        else
-        {
-            MassDeterIntExtTri( tri, meshVec );
         }
     }
+
+    for ( i = 0 ; i < num_split ; i++ )
+    {
+        region[i] = int_ext_find( region, i );
+    }
 }
 
+#define INT_EXT_CHUNK 256           // Parent Tris Per Task
 
-void TMesh::MassDeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec )
+void TMesh::DeterIntExtBatch( vector< TMesh* >& meshVec, int mode, int num_threads )
 {
-    vec3d orig = ( tri->m_N0->m_Pnt + tri->m_N1->m_Pnt ) * 0.5;
-    orig = ( orig + tri->m_N2->m_Pnt ) * 0.5;
-    tri->m_InteriorFlag = 1;
-    int prior = -1;
-
-    vec3d dir( 1.0, 0.000001, 0.000001 );
+    int num_tris = ( int )m_TVec.size();
+    int num_chunks = ( num_tris + INT_EXT_CHUNK - 1 ) / INT_EXT_CHUNK;
 
-    for ( int m = 0 ; m < ( int )meshVec.size() ; m++ )
+    ThreadPool pool( num_chunks > 1 ? num_threads : 1 );
+    pool.Run( num_chunks, [&]( int c )
     {
-        if ( meshVec[m] != this )
+        int begin = c * INT_EXT_CHUNK;
+        int end = min( begin + INT_EXT_CHUNK, num_tris );
+
+        //==== One Ray Per Region, The Other Tris In The Region Follow It ====//
+        vector< TTri* > rep_vec;
+        vector< TTri* > follow_vec;
+        vector< int > follow_rep;
+        vector< int > region;
+        for ( int t = begin ; t < end ; t++ )
         {
-            vector<double > tParmVec;
-            meshVec[m]->m_TBox.RayCast( orig, dir, tParmVec );
-            if ( tParmVec.size() % 2 )
+            TTri* tri = m_TVec[t];
+
+            //==== Do Interior Tris ====//
+            if ( tri->m_SplitVec.size() )
             {
-                if ( meshVec[m]->m_MassPrior > prior )
+                tri->m_InteriorFlag = 1;
+
+                int_ext_split_regions( tri, region );
+                vector< int > region_rep( region.size(), -1 );
+                for ( int s = 0 ; s < ( int )tri->m_SplitVec.size() ; s++ )
                 {
-                    tri->m_InteriorFlag = 0;
-                    tri->m_ID = meshVec[m]->m_PtrID;
-                    tri->m_Density = meshVec[m]->m_Density;
-                    prior = meshVec[m]->m_MassPrior;
+                    if ( region[s] == s )
+                    {
+                        region_rep[s] = ( int )rep_vec.size();
+                        rep_vec.push_back( tri->m_SplitVec[s] );
+                    }
+                    else
+                    {
+                        follow_vec.push_back( tri->m_SplitVec[s] );
+                        follow_rep.push_back( region_rep[ region[s] ] );
+                    }
                 }
             }
+            else
+            {
+                rep_vec.push_back( tri );
+            }
         }
-    }
-}
 
-void TMesh::WaveDeterIntExt( vector< TMesh* >& meshVec )
-{
-    for ( int t = 0 ; t < ( int )m_TVec.size() ; t++ )
-    {
-        TTri* tri = m_TVec[t];
+        int num_rep = ( int )rep_vec.size();
+        vector< vec3d > orig_vec( num_rep );
+        vector< int > prior_vec( num_rep, -1 );
+        vector< bool > done_vec( num_rep, false );
+        for ( int r = 0 ; r < num_rep ; r++ )
+        {
+            orig_vec[r] = int_ext_orig( rep_vec[r] );
+            int_ext_init( rep_vec[r], mode );
+        }
 
-        //==== Do Interior Tris ====//
-        if ( tri->m_SplitVec.size() )
+        //==== Cast The Whole Batch Against One Mesh At A Time ====//
+        vec3d dir( 1.0, 0.000001, 0.000001 );
+        vector< double > hits;
+        for ( int m = 0 ; m < ( int )meshVec.size() ; m++ )
         {
-            tri->m_InteriorFlag = 1;
-            for ( int s = 0 ; s < ( int )tri->m_SplitVec.size() ; s++ )
+            if ( meshVec[m] == this )
             {
-                WaveDeterIntExtTri( tri->m_SplitVec[s], meshVec );
+                continue;
+            }
+
+            for ( int r = 0 ; r < num_rep ; r++ )
+            {
+                if ( !done_vec[r] && meshVec[m]->PntInside( orig_vec[r], dir, hits ) )
+                {
+                    done_vec[r] = int_ext_inside( rep_vec[r], meshVec[m], mode, prior_vec[r] );
+                }
             }
         }
-        else
+
+        for ( int f = 0 ; f < ( int )follow_vec.size() ; f++ )
         {
-            WaveDeterIntExtTri( tri, meshVec );
+            int r = follow_rep[f];
+            int_ext_copy( follow_vec[f], rep_vec[r], mode, prior_vec[r] );
         }
-    }
+    } );
 }
 
-void TMesh::WaveDeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec )
+//==== Point Inside By Ray Parity - Falls Back To Winding Number When A Hit Is Ambiguous ====//
+bool TMesh::PntInside( vec3d & orig, vec3d & dir, vector< double > & hits )
 {
-    vec3d orig = ( tri->m_N0->m_Pnt + tri->m_N1->m_Pnt ) * 0.5;
-    orig = ( orig + tri->m_N2->m_Pnt ) * 0.5;
-    tri->m_InteriorFlag = 0;
-    int prior = -1;
+    hits.clear();
 
-    vec3d dir( 1.0, 0.000001, 0.000001 );
+    bool degen_flag = false;
+    m_TBox.RayCast( orig, dir, hits, &degen_flag );
 
-    for ( int m = 0 ; m < ( int )meshVec.size() ; m++ )
+    if ( degen_flag )
     {
-        if ( meshVec[m] != this )
-        {
-            vector<double > tParmVec;
-            meshVec[m]->m_TBox.RayCast( orig, dir, tParmVec );
-            if ( tParmVec.size() % 2 )
-            {
-                if ( meshVec[m]->m_MassPrior > prior )
-                {
-                    tri->m_InteriorFlag = 1;
-                    tri->m_ID = meshVec[m]->m_PtrID;
-                    prior = meshVec[m]->m_MassPrior;
-                }
-            }
-        }
+        return std::abs( WindingNumber( orig ) ) > 0.5;
     }
+    return ( hits.size() % 2 ) == 1;
+}
+
+//==== Generalized Winding Number - Sum of Tri Solid Angles / 4 PI ====//
+double TMesh::WindingNumber( const vec3d & pnt )
+{
+    double sum = 0.0;
+    for ( int t = 0 ; t < ( int )m_TVec.size() ; t++ )
+    {
+        TTri* tri = m_TVec[t];
+        vec3d a = tri->m_N0->m_Pnt - pnt;
+        vec3d b = tri->m_N1->m_Pnt - pnt;
+        vec3d c = tri->m_N2->m_Pnt - pnt;
+
+        double la = a.mag();
+        double lb = b.mag();
+        double lc = c.mag();
+
+        double num = dot( a, cross( b, c ) );
+        double den = la * lb * lc + dot( a, b ) * lc + dot( a, c ) * lb + dot( b, c ) * la;
+
+        sum += 2.0 * atan2( num, den );
+    }
+    return sum / ( 4.0 * PI );
+}
+
+void TMesh::MassDeterIntExt( vector< TMesh* >& meshVec )
+{
+    DeterIntExtBatch( meshVec, MASS_DETER_INT_EXT );
+}
+
+void TMesh::WaveDeterIntExt( vector< TMesh* >& meshVec )
+{
+    DeterIntExtBatch( meshVec, WAVE_DETER_INT_EXT );
 }
 
 double TMesh::ComputeTheoArea()
@@ -1210,7 +1337,7 @@ void TMesh::LoadBndBox()
         m_TBox.AddTri( m_TVec[i] );
     }
 
-    m_TBox.SplitBox();
+    m_TBox.Build();
 }
 
 //==== Write STL Tris =====//
@@ -1313,9 +1440,6 @@ int TMesh::NumVerts()
 
 TTri::TTri()
 {
-    static int cnt = 0;
-    cnt++;
-//printf("Tri Construct Cnt = %d \n", cnt);
     m_E0 = m_E1 = m_E2 = 0;
     m_N0 = m_N1 = m_N2 = 0;
     m_InteriorFlag = 0;
@@ -1327,9 +1451,6 @@ TTri::TTri()
 
 TTri::~TTri()
 {
-    static int cnt = 0;
-    cnt++;
-//printf("Tri Destruct Cnt = %d \n", cnt);
     int i;
 
     //==== Delete Split Edges ====//
@@ -2218,508 +2339,813 @@ void TTri::SplitEdges( TNode* n01, TNode* n12, TNode* n20 )
 //===============================================//
 //===============================================//
 //===============================================//
-//                  TBndBox
+//                  Tri Pairs
 //===============================================//
 //===============================================//
 //===============================================//
 //===============================================//
 
-TBndBox::TBndBox()
+//==== Intersect Two Tris and Store Intersection Edges In Both ====//
+static void intersect_tri_pair( TTri* t0, TTri* t1, bool UWFlag )
 {
-    for ( int i = 0 ; i < 8 ; i++ )
+    double tol = 1e-6; // was 1e-6
+
+    int coplanarFlag;
+    vec3d e0;
+    vec3d e1;
+
+    int iflag = tri_tri_intersect_with_isectline(
+                    t0->m_N0->m_Pnt.v, t0->m_N1->m_Pnt.v, t0->m_N2->m_Pnt.v,
+                    t1->m_N0->m_Pnt.v, t1->m_N1->m_Pnt.v, t1->m_N2->m_Pnt.v,
+                    &coplanarFlag, e0.v, e1.v );
+
+    if ( iflag && !coplanarFlag )
     {
-        m_SBoxVec[i] = 0;
+        if ( UWFlag )
+        {
+            if ( dist( e0, e1 ) > tol ) // was 1e-6
+            {
+                // Figure out with tri has xyz info
+                TTri* tri;
+                int d_info = TNode::HAS_XYZ; // desired info number
+                if ( ( t0->m_N0->GetCoordInfo() & d_info ) == d_info &&  ( t0->m_N1->GetCoordInfo() & d_info ) == d_info
+                        && ( t0->m_N2->GetCoordInfo() & d_info ) == d_info )
+                {
+                    tri = t0;
+                }
+                else
+                {
+                    tri = t1;
+                }
+                // Use Bilinear interpolation to convert edge uw points to xyz points
+                vec3d e0xyz = tri->CompPnt( e0 );
+                vec3d e1xyz = tri->CompPnt( e1 );
+
+                // Create the new edges
+
+                TEdge* ie0 = new TEdge();
+                int info = TNode::HAS_UW | TNode::HAS_XYZ;
+                ie0->m_N0 = new TNode();
+                ie0->m_N0->SetUWPnt( e0 );
+                ie0->m_N0->SetXYZPnt( e0xyz );
+                ie0->m_N0->MakePntUW();
+                ie0->m_N0->SetCoordInfo( info );
+                ie0->m_N1 = new TNode();
+                ie0->m_N1->SetUWPnt( e1 );
+                ie0->m_N1->SetXYZPnt( e1xyz );
+                ie0->m_N1->MakePntUW();
+                ie0->m_N1->SetCoordInfo( info );
+
+                TEdge* ie1 = new TEdge();
+                ie1->m_N0 = new TNode();
+                ie1->m_N0->SetUWPnt( e0 );
+                ie1->m_N0->SetXYZPnt( e0xyz );
+                ie1->m_N0->MakePntUW();
+                ie1->m_N0->SetCoordInfo( info );
+                ie1->m_N1 = new TNode();
+                ie1->m_N1->SetUWPnt( e1 );
+                ie1->m_N1->SetXYZPnt( e1xyz );
+                ie1->m_N1->MakePntUW();
+                ie1->m_N1->SetCoordInfo( info );
+
+                t0->m_ISectEdgeVec.push_back( ie0 );
+                t1->m_ISectEdgeVec.push_back( ie1 );
+
+                if ( tri->GetTMeshPtr() )
+                {
+                    tri->GetTMeshPtr()->SplitAliasEdges( tri, tri->m_ISectEdgeVec.back() );
+                }
+
+            }
+        }
+        else
+        {
+            TEdge* ie0 = new TEdge();
+            ie0->m_N0 = new TNode();
+            ie0->m_N0->m_Pnt = e0;
+            ie0->m_N1 = new TNode();
+            ie0->m_N1->m_Pnt = e1;
+
+            TEdge* ie1 = new TEdge();
+            ie1->m_N0 = new TNode();
+            ie1->m_N0->m_Pnt = e0;
+            ie1->m_N1 = new TNode();
+            ie1->m_N1->m_Pnt = e1;
+
+
+            if ( dist( e0, e1 ) > tol )
+            {
+                t0->m_ISectEdgeVec.push_back( ie0 );
+                t1->m_ISectEdgeVec.push_back( ie1 );
+            }
+            else
+            {
+                delete ie0->m_N0;
+                delete ie0->m_N1;
+                delete ie1->m_N0;
+                delete ie1->m_N1;
+                delete ie0;
+                delete ie1;
+            }
+        }
     }
 }
 
-TBndBox::~TBndBox()
+//===============================================//
+//===============================================//
+//===============================================//
+//===============================================//
+//                  TBvh
+//===============================================//
+//===============================================//
+//===============================================//
+//===============================================//
+
+#define TBVH_NUM_BINS 16            // SAH Candidate Splits Per Node
+#define TBVH_MAX_LEAF_TRIS 8        // Leaves Can Be Forced Smaller, Never Larger Unless Unsplittable
+#define TBVH_MAX_DEPTH 64           // Keeps Traversal Stacks Fixed Size
+#define TBVH_PARALLEL_MIN_TRIS 20000 // Smaller Meshes Build Faster On One Thread
+
+//==== Tri Bounds and Centroid Used While Building ====//
+class TBvhPrim
 {
-    for ( int i = 0 ; i < 8 ; i++ )
+public:
+    double m_Min[3];
+    double m_Max[3];
+    double m_Cen[3];
+};
+
+//==== Subtree Left For A Worker Thread ====//
+class TBvhTask
+{
+public:
+    int m_Node;
+    int m_Begin;
+    int m_End;
+    int m_Depth;
+};
+
+//==== Round Outward So Float Boxes Always Contain The Double Box ====//
+static float bvh_round_down( double d )
+{
+    float f = ( float )d;
+    if ( f > d )
     {
-        delete m_SBoxVec[i];
+        f = std::nextafter( f, -FLT_MAX );
     }
+    return f;
 }
 
-void TBndBox::Reset()
+static float bvh_round_up( double d )
 {
-    for ( int i = 0 ; i < 8 ; i++ )
+    float f = ( float )d;
+    if ( f < d )
     {
-        delete m_SBoxVec[i];
-        m_SBoxVec[i] = 0;
+        f = std::nextafter( f, FLT_MAX );
     }
+    return f;
+}
 
-    m_Box.Reset();
-    m_TriVec.clear();
+static double bvh_half_area( const double bmin[3], const double bmax[3] )
+{
+    double dx = bmax[0] - bmin[0];
+    double dy = bmax[1] - bmin[1];
+    double dz = bmax[2] - bmin[2];
+    return dx * dy + dy * dz + dz * dx;
 }
 
-//==== Create Oct Tree of Overlaping BndBoxes ====//
-void TBndBox::SplitBox()
+static double bvh_half_area( const TBvhNode & n )
 {
-    int i;
-    if ( m_TriVec.size() > 32 )
+    double dx = n.m_Max[0] - n.m_Min[0];
+    double dy = n.m_Max[1] - n.m_Min[1];
+    double dz = n.m_Max[2] - n.m_Min[2];
+    return dx * dy + dy * dz + dz * dx;
+}
+
+static bool bvh_overlap( const TBvhNode & a, const TBvhNode & b, double tol )
+{
+    for ( int k = 0 ; k < 3 ; k++ )
     {
-        //==== Find Split Points ====//
-        double hx = 0.5 * ( m_Box.GetMax( 0 ) + m_Box.GetMin( 0 ) );
-        double hy = 0.5 * ( m_Box.GetMax( 1 ) + m_Box.GetMin( 1 ) );
-        double hz = 0.5 * ( m_Box.GetMax( 2 ) + m_Box.GetMin( 2 ) );
+        if ( a.m_Min[k] > b.m_Max[k] + tol || b.m_Min[k] > a.m_Max[k] + tol )
+        {
+            return false;
+        }
+    }
+    return true;
+}
 
-        for ( i = 0 ; i < 8 ; i++ )
+//==== Squared Distance Between Node Boxes, Zero If They Overlap ====//
+static double bvh_dist_squared( const TBvhNode & a, const TBvhNode & b )
+{
+    double d2 = 0.0;
+    for ( int k = 0 ; k < 3 ; k++ )
+    {
+        double gap = max( a.m_Min[k] - b.m_Max[k], b.m_Min[k] - a.m_Max[k] );
+        if ( gap > 0.0 )
         {
-            m_SBoxVec[i] = new TBndBox();
+            d2 += gap * gap;
         }
+    }
+    return d2;
+}
 
-        for ( i = 0 ; i < ( int )m_TriVec.size() ; i++ )
+//==== Does Ray orig + t * dir, t >= 0, Hit Node Box ====//
+static bool bvh_ray_hit( const TBvhNode & n, const double orig[3], const double dir[3] )
+{
+    double tmin = 0.0;
+    double tmax = DBL_MAX;
+    for ( int k = 0 ; k < 3 ; k++ )
+    {
+        if ( dir[k] == 0.0 )
         {
-            int cnt = 0;
-            if ( m_TriVec[i]->m_N0->m_Pnt.x() > hx )
+            if ( orig[k] < n.m_Min[k] || orig[k] > n.m_Max[k] )
             {
-                cnt += 1;
+                return false;
             }
-            if ( m_TriVec[i]->m_N0->m_Pnt.y() > hy )
+        }
+        else
+        {
+            double t0 = ( n.m_Min[k] - orig[k] ) / dir[k];
+            double t1 = ( n.m_Max[k] - orig[k] ) / dir[k];
+            if ( t0 > t1 )
             {
-                cnt += 2;
+                std::swap( t0, t1 );
             }
-            if ( m_TriVec[i]->m_N0->m_Pnt.z() > hz )
+            tmin = max( tmin, t0 );
+            tmax = min( tmax, t1 );
+            if ( tmin > tmax )
             {
-                cnt += 4;
+                return false;
             }
-            m_SBoxVec[cnt]->AddTri( m_TriVec[i] );
         }
+    }
+    return true;
+}
 
-        int contSplitFlag = 1;
+//==== Add Ray Hit Unless T Is Already Included - Flag Hits On A Tri Edge Or Vertex ====//
+static void bvh_ray_tri( TTri* tri, vec3d & orig, vec3d & dir, vector<double> & tParmVec, bool* degen_flag )
+{
+    double tparm, uparm, vparm;
+    int iFlag = intersect_triangle( orig.v, dir.v,
+                                    tri->m_N0->m_Pnt.v, tri->m_N1->m_Pnt.v, tri->m_N2->m_Pnt.v, &tparm, &uparm, &vparm );
 
-        for ( i = 0 ; i < 8 ; i++ )
+    if ( iFlag && tparm > 0.0 )
+    {
+        double tol = 1.0e-7;
+        if ( degen_flag && ( uparm < tol || vparm < tol || uparm + vparm > 1.0 - tol ) )
         {
-            if ( m_TriVec.size() == m_SBoxVec[i]->m_TriVec.size() )
-            {
-                contSplitFlag = 0;
-                break;
-            }
+            *degen_flag = true;
         }
-        if ( contSplitFlag )
+
+        for ( int j = 0 ; j < ( int )tParmVec.size() ; j++ )
         {
-            for ( i = 0 ; i < 8 ; i++ )
+            if ( std::abs( tparm - tParmVec[j] ) < 0.0000001 )
             {
-                m_SBoxVec[i]->SplitBox();
+                return;
             }
         }
+        tParmVec.push_back( tparm );
     }
 }
 
-void TBndBox::AddTri( TTri* t )
+//==== Build Node Over Prims ind[begin] ... ind[end-1] - Partitions ind In Place ====//
+static void bvh_build_node( vector< TBvhNode > & nodes, const vector< TBvhPrim > & prims, vector< int > & ind,
+                            int node, int begin, int end, int depth, int spawn_size, vector< TBvhTask > * tasks )
 {
-    m_TriVec.push_back( t );
-    m_Box.Update( t->m_N0->m_Pnt );
-    m_Box.Update( t->m_N1->m_Pnt );
-    m_Box.Update( t->m_N2->m_Pnt );
-}
-
-void  TBndBox::AddLeafNodes( vector< TBndBox* > & leafVec )
-{
-    int i;
+    int i, k;
+    double bmin[3], bmax[3], cmin[3], cmax[3];
+    for ( k = 0 ; k < 3 ; k++ )
+    {
+        bmin[k] = cmin[k] = DBL_MAX;
+        bmax[k] = cmax[k] = -DBL_MAX;
+    }
 
-    if ( m_SBoxVec[0] )     // Keep Moving Down
+    for ( i = begin ; i < end ; i++ )
     {
-        for ( i = 0 ; i < 8 ; i++ )
+        const TBvhPrim & p = prims[ ind[i] ];
+        for ( k = 0 ; k < 3 ; k++ )
         {
-            m_SBoxVec[i]->AddLeafNodes( leafVec );
+            bmin[k] = min( bmin[k], p.m_Min[k] );
+            bmax[k] = max( bmax[k], p.m_Max[k] );
+            cmin[k] = min( cmin[k], p.m_Cen[k] );
+            cmax[k] = max( cmax[k], p.m_Cen[k] );
         }
     }
-    else
+
+    for ( k = 0 ; k < 3 ; k++ )
     {
-        leafVec.push_back( this );
+        nodes[node].m_Min[k] = bvh_round_down( bmin[k] );
+        nodes[node].m_Max[k] = bvh_round_up( bmax[k] );
     }
-}
+    nodes[node].m_Index = begin;
+    nodes[node].m_Count = end - begin;
 
-bool TBndBox::CheckIntersect( TBndBox* iBox  )
-{
-    int i, j;
+    int num = end - begin;
+    if ( num <= 2 || depth >= TBVH_MAX_DEPTH )
+    {
+        return;
+    }
 
-    //==== Compare Bounding Boxes ====//
-    if ( !Compare( m_Box, iBox->m_Box ) )
+    //==== Leave Big Subtrees For The Thread Pool ====//
+    if ( tasks && num <= spawn_size )
     {
-        return false;
+        TBvhTask task;
+        task.m_Node = node;
+        task.m_Begin = begin;
+        task.m_End = end;
+        task.m_Depth = depth;
+        tasks->push_back( task );
+        return;
     }
 
-    //==== Recursively Check Sub Boxes ====//
-    if ( m_SBoxVec[0] )
+    //==== Split Along Longest Centroid Axis ====//
+    int axis = 0;
+    for ( k = 1 ; k < 3 ; k++ )
     {
-        for ( i = 0 ; i < 8 ; i++ )
+        if ( cmax[k] - cmin[k] > cmax[axis] - cmin[axis] )
         {
-           if ( iBox->CheckIntersect( m_SBoxVec[i] ) )
-           return true;
+            axis = k;
         }
     }
-    else if ( iBox->m_SBoxVec[0] )
+    double extent = cmax[axis] - cmin[axis];
+
+    int mid = -1;
+    if ( extent > 0.0 )
     {
-        for ( i = 0 ; i < 8 ; i++ )
+        //==== Bin Centroids and Find Lowest SAH Cost Split ====//
+        int bin_cnt[TBVH_NUM_BINS];
+        double bin_min[TBVH_NUM_BINS][3], bin_max[TBVH_NUM_BINS][3];
+        for ( int b = 0 ; b < TBVH_NUM_BINS ; b++ )
         {
-            if ( iBox->m_SBoxVec[i]->CheckIntersect( this ) )
-                return true;
+            bin_cnt[b] = 0;
+            for ( k = 0 ; k < 3 ; k++ )
+            {
+                bin_min[b][k] = DBL_MAX;
+                bin_max[b][k] = -DBL_MAX;
+            }
         }
-    }
-    else
-    {
-        int coplanarFlag;
-        vec3d e0;
-        vec3d e1;
 
-        //==== Check All Tris In One Box Against The Other ====//
-        for ( i = 0 ; i < ( int )m_TriVec.size() ; i++ )
+        double scale = TBVH_NUM_BINS / extent;
+        for ( i = begin ; i < end ; i++ )
         {
-            TTri* t0 = m_TriVec[i];
-            for ( j = 0 ; j < ( int )iBox->m_TriVec.size() ; j++ )
+            const TBvhPrim & p = prims[ ind[i] ];
+            int b = min( TBVH_NUM_BINS - 1, ( int )( ( p.m_Cen[axis] - cmin[axis] ) * scale ) );
+            bin_cnt[b]++;
+            for ( k = 0 ; k < 3 ; k++ )
             {
-                TTri* t1 = iBox->m_TriVec[j];
+                bin_min[b][k] = min( bin_min[b][k], p.m_Min[k] );
+                bin_max[b][k] = max( bin_max[b][k], p.m_Max[k] );
+            }
+        }
 
-                int iflag = tri_tri_intersect_with_isectline(
-                                t0->m_N0->m_Pnt.v, t0->m_N1->m_Pnt.v, t0->m_N2->m_Pnt.v,
-                                t1->m_N0->m_Pnt.v, t1->m_N1->m_Pnt.v, t1->m_N2->m_Pnt.v,
-                                &coplanarFlag, e0.v, e1.v );
+        //==== Sweep Right To Left Then Left To Right ====//
+        double right_area[TBVH_NUM_BINS];
+        int right_cnt[TBVH_NUM_BINS];
+        double rmin[3] = { DBL_MAX, DBL_MAX, DBL_MAX };
+        double rmax[3] = { -DBL_MAX, -DBL_MAX, -DBL_MAX };
+        int cnt = 0;
+        for ( int b = TBVH_NUM_BINS - 1 ; b > 0 ; b-- )
+        {
+            cnt += bin_cnt[b];
+            for ( k = 0 ; k < 3 ; k++ )
+            {
+                rmin[k] = min( rmin[k], bin_min[b][k] );
+                rmax[k] = max( rmax[k], bin_max[b][k] );
+            }
+            right_cnt[b] = cnt;
+            right_area[b] = cnt ? bvh_half_area( rmin, rmax ) : 0.0;
+        }
 
-                if ( iflag && !coplanarFlag )
-                    return true;
+        double lmin[3] = { DBL_MAX, DBL_MAX, DBL_MAX };
+        double lmax[3] = { -DBL_MAX, -DBL_MAX, -DBL_MAX };
+        cnt = 0;
+        int best_split = -1;
+        double best_cost = DBL_MAX;
+        for ( int b = 1 ; b < TBVH_NUM_BINS ; b++ )
+        {
+            cnt += bin_cnt[b - 1];
+            for ( k = 0 ; k < 3 ; k++ )
+            {
+                lmin[k] = min( lmin[k], bin_min[b - 1][k] );
+                lmax[k] = max( lmax[k], bin_max[b - 1][k] );
+            }
+            if ( cnt == 0 || right_cnt[b] == 0 )
+            {
+                continue;
+            }
+            double cost = cnt * bvh_half_area( lmin, lmax ) + right_cnt[b] * right_area[b];
+            if ( cost < best_cost )
+            {
+                best_cost = cost;
+                best_split = b;
             }
         }
+
+        //==== Compare To Cost Of Testing Every Tri In A Leaf ====//
+        double area = bvh_half_area( bmin, bmax );
+        if ( best_split > 0 && area > 0.0 )
+        {
+            double split_cost = 1.0 + best_cost / area;
+            if ( split_cost >= num && num <= TBVH_MAX_LEAF_TRIS )
+            {
+                return;
+            }
+
+            mid = ( int )( std::partition( ind.begin() + begin, ind.begin() + end, [&]( int t )
+            {
+                return min( TBVH_NUM_BINS - 1, ( int )( ( prims[t].m_Cen[axis] - cmin[axis] ) * scale ) ) < best_split;
+            } ) - ind.begin() );
+        }
     }
-    return false;
+
+    //==== Coincident Centroids - Split In Half If Too Many For A Leaf ====//
+    if ( mid <= begin || mid >= end )
+    {
+        if ( num <= TBVH_MAX_LEAF_TRIS )
+        {
+            return;
+        }
+        mid = ( begin + end ) / 2;
+    }
+
+    int left = ( int )nodes.size();
+    nodes.push_back( TBvhNode() );
+    nodes.push_back( TBvhNode() );
+    nodes[node].m_Index = left;
+    nodes[node].m_Count = 0;
+
+    bvh_build_node( nodes, prims, ind, left, begin, mid, depth + 1, spawn_size, tasks );
+    bvh_build_node( nodes, prims, ind, left + 1, mid, end, depth + 1, spawn_size, tasks );
 }
 
-double TBndBox::MinDistance( TBndBox* iBox, double curr_min_dist )
+TBvh::TBvh()
 {
-    int i, j;
+}
+
+TBvh::~TBvh()
+{
+}
+
+void TBvh::Reset()
+{
+    m_NodeVec.clear();
+    m_Box.Reset();
+    m_TriVec.clear();
+}
+
+void TBvh::AddTri( TTri* t )
+{
+    m_TriVec.push_back( t );
+    m_Box.Update( t->m_N0->m_Pnt );
+    m_Box.Update( t->m_N1->m_Pnt );
+    m_Box.Update( t->m_N2->m_Pnt );
+}
 
-    //==== Compare Bounding Boxes ====//
-    if ( !Compare( m_Box, iBox->m_Box, curr_min_dist ) )
+//==== Build Hierarchy Over All Added Tris ====//
+void TBvh::Build( int num_threads )
+{
+    int i, k;
+    m_NodeVec.clear();
+
+    int num_tris = ( int )m_TriVec.size();
+    if ( num_tris == 0 )
     {
-        return curr_min_dist;
+        return;
     }
 
-    //==== Recursively Check Sub Boxes ====//
-    if ( m_SBoxVec[0] )
+    vector< TBvhPrim > prims( num_tris );
+    vector< int > ind( num_tris );
+    for ( i = 0 ; i < num_tris ; i++ )
     {
-        for ( i = 0 ; i < 8 ; i++ )
+        vec3d* pnts[3] = { &m_TriVec[i]->m_N0->m_Pnt, &m_TriVec[i]->m_N1->m_Pnt, &m_TriVec[i]->m_N2->m_Pnt };
+        for ( k = 0 ; k < 3 ; k++ )
         {
-            curr_min_dist = iBox->MinDistance( m_SBoxVec[i], curr_min_dist );
+            prims[i].m_Min[k] = min( min( pnts[0]->v[k], pnts[1]->v[k] ), pnts[2]->v[k] );
+            prims[i].m_Max[k] = max( max( pnts[0]->v[k], pnts[1]->v[k] ), pnts[2]->v[k] );
+            prims[i].m_Cen[k] = ( pnts[0]->v[k] + pnts[1]->v[k] + pnts[2]->v[k] ) / 3.0;
         }
+        ind[i] = i;
     }
-    else if ( iBox->m_SBoxVec[0] )
+
+    m_NodeVec.reserve( 2 * num_tris / 3 + 1 );
+    m_NodeVec.push_back( TBvhNode() );
+
+    if ( num_tris < TBVH_PARALLEL_MIN_TRIS )
     {
-        for ( i = 0 ; i < 8 ; i++ )
-        {
-            curr_min_dist = iBox->m_SBoxVec[i]->MinDistance( this, curr_min_dist );
-        }
+        bvh_build_node( m_NodeVec, prims, ind, 0, 0, num_tris, 0, 0, NULL );
     }
-    //==== Check All Points Against Other Points ====//
     else
     {
-        for ( i = 0 ; i < ( int )m_TriVec.size() ; i++ )
+        //==== Split Top Levels Here, Then Build Subtrees On Worker Threads ====//
+        ThreadPool pool( num_threads );
+        int spawn_size = max( TBVH_PARALLEL_MIN_TRIS / 8, num_tris / ( 4 * pool.GetNumThreads() ) );
+
+        vector< TBvhTask > tasks;
+        bvh_build_node( m_NodeVec, prims, ind, 0, 0, num_tris, 0, spawn_size, &tasks );
+
+        vector< vector< TBvhNode > > sub_nodes( tasks.size() );
+        pool.Run( ( int )tasks.size(), [&]( int t )
         {
-            TTri* t0 = m_TriVec[i];
-            for ( j = 0 ; j < ( int )iBox->m_TriVec.size() ; j++ )
-            {
+            sub_nodes[t].push_back( m_NodeVec[ tasks[t].m_Node ] );
+            bvh_build_node( sub_nodes[t], prims, ind, 0, tasks[t].m_Begin, tasks[t].m_End, tasks[t].m_Depth, 0, NULL );
+        } );
 
-                TTri* t1 = iBox->m_TriVec[j];
-                double d = tri_tri_min_dist( t0->m_N0->m_Pnt, t0->m_N1->m_Pnt, t0->m_N2->m_Pnt,
-                                             t1->m_N0->m_Pnt, t1->m_N1->m_Pnt, t1->m_N2->m_Pnt);
+        //==== Append Subtrees In Task Order - Sub Node n > 0 Goes To base + n - 1 ====//
+        for ( int t = 0 ; t < ( int )tasks.size() ; t++ )
+        {
+            int base = ( int )m_NodeVec.size();
+            for ( int n = 0 ; n < ( int )sub_nodes[t].size() ; n++ )
+            {
+                TBvhNode node = sub_nodes[t][n];
+                if ( node.m_Count == 0 )
+                {
+                    node.m_Index += base - 1;
+                }
 
-                if ( d < curr_min_dist )
-                    curr_min_dist = d;
+                if ( n == 0 )
+                {
+                    m_NodeVec[ tasks[t].m_Node ] = node;
+                }
+                else
+                {
+                    m_NodeVec.push_back( node );
+                }
             }
         }
     }
 
-    return curr_min_dist;
+    //==== Reorder Tris So Each Leaf Is Contiguous ====//
+    vector< TTri* > tri_vec( num_tris );
+    for ( i = 0 ; i < num_tris ; i++ )
+    {
+        tri_vec[i] = m_TriVec[ ind[i] ];
+    }
+    m_TriVec.swap( tri_vec );
 }
 
-
-void TBndBox::Intersect( TBndBox* iBox, bool UWFlag )
+bool TBvh::TraverseLeafPairs( TBvh* iBvh, const double & tol, const std::function< bool( int, int ) > & leaf_pair )
 {
-    int i;
-
-    double tol = 1e-6; // was 1e-6
-
-    if ( !Compare( m_Box, iBox->m_Box ) )
+    if ( m_NodeVec.empty() || iBvh->m_NodeVec.empty() )
     {
-        return;
+        return false;
     }
 
-    if ( m_SBoxVec[0] )
+    vector< pair< int, int > > stack;
+    stack.reserve( 2 * TBVH_MAX_DEPTH + 2 );
+    stack.push_back( pair< int, int >( 0, 0 ) );
+
+    while ( !stack.empty() )
     {
-        for ( i = 0 ; i < 8 ; i++ )
+        int a = stack.back().first;
+        int b = stack.back().second;
+        stack.pop_back();
+
+        const TBvhNode & na = m_NodeVec[a];
+        const TBvhNode & nb = iBvh->m_NodeVec[b];
+
+        //==== tol Can Shrink While Traversing ====//
+        if ( bvh_dist_squared( na, nb ) > tol * tol )
+        {
+            continue;
+        }
+
+        if ( na.m_Count > 0 && nb.m_Count > 0 )
+        {
+            if ( leaf_pair( a, b ) )
+            {
+                return true;
+            }
+            continue;
+        }
+
+        //==== Split The Larger Box, Visit The Nearer Child First ====//
+        pair< int, int > c0, c1;
+        double d0, d1;
+        if ( nb.m_Count > 0 || ( na.m_Count == 0 && bvh_half_area( na ) >= bvh_half_area( nb ) ) )
         {
-            iBox->Intersect( m_SBoxVec[i], UWFlag );
+            c0 = pair< int, int >( na.m_Index, b );
+            c1 = pair< int, int >( na.m_Index + 1, b );
+            d0 = bvh_dist_squared( m_NodeVec[ c0.first ], nb );
+            d1 = bvh_dist_squared( m_NodeVec[ c1.first ], nb );
         }
+        else
+        {
+            c0 = pair< int, int >( a, nb.m_Index );
+            c1 = pair< int, int >( a, nb.m_Index + 1 );
+            d0 = bvh_dist_squared( na, iBvh->m_NodeVec[ c0.second ] );
+            d1 = bvh_dist_squared( na, iBvh->m_NodeVec[ c1.second ] );
+        }
+
+        if ( d1 < d0 )
+        {
+            std::swap( c0, c1 );
+        }
+        stack.push_back( c1 );
+        stack.push_back( c0 );
     }
-    else if ( iBox->m_SBoxVec[0] )
+    return false;
+}
+
+void TBvh::Intersect( TBvh* iBvh, bool UWFlag )
+{
+    double tol = 1.0e-12;
+    TraverseLeafPairs( iBvh, tol, [&]( int a, int b )
     {
-        for ( i = 0 ; i < 8 ; i++ )
+        const TBvhNode & na = m_NodeVec[a];
+        const TBvhNode & nb = iBvh->m_NodeVec[b];
+        for ( int i = na.m_Index ; i < na.m_Index + na.m_Count ; i++ )
         {
-            iBox->m_SBoxVec[i]->Intersect( this, UWFlag );
+            for ( int j = nb.m_Index ; j < nb.m_Index + nb.m_Count ; j++ )
+            {
+                intersect_tri_pair( m_TriVec[i], iBvh->m_TriVec[j], UWFlag );
+            }
         }
-    }
-    else
+        return false;
+    } );
+}
+
+bool TBvh::CheckIntersect( TBvh* iBvh )
+{
+    double tol = 1.0e-12;
+    return TraverseLeafPairs( iBvh, tol, [&]( int a, int b )
     {
         int coplanarFlag;
         vec3d e0;
         vec3d e1;
 
-        int iCnt = 0;
-
-        for ( i = 0 ; i < ( int )m_TriVec.size() ; i++ )
+        const TBvhNode & na = m_NodeVec[a];
+        const TBvhNode & nb = iBvh->m_NodeVec[b];
+        for ( int i = na.m_Index ; i < na.m_Index + na.m_Count ; i++ )
         {
             TTri* t0 = m_TriVec[i];
-            for ( int j = 0 ; j < ( int )iBox->m_TriVec.size() ; j++ )
+            for ( int j = nb.m_Index ; j < nb.m_Index + nb.m_Count ; j++ )
             {
-                TTri* t1 = iBox->m_TriVec[j];
+                TTri* t1 = iBvh->m_TriVec[j];
 
                 int iflag = tri_tri_intersect_with_isectline(
                                 t0->m_N0->m_Pnt.v, t0->m_N1->m_Pnt.v, t0->m_N2->m_Pnt.v,
                                 t1->m_N0->m_Pnt.v, t1->m_N1->m_Pnt.v, t1->m_N2->m_Pnt.v,
                                 &coplanarFlag, e0.v, e1.v );
 
-                iCnt += iflag;
                 if ( iflag && !coplanarFlag )
                 {
-                    if ( UWFlag )
-                    {
-                        if ( dist( e0, e1 ) > tol ) // was 1e-6
-                        {
-                            // Figure out with tri has xyz info
-                            TTri* tri;
-                            int d_info = TNode::HAS_XYZ; // desired info number
-                            if ( ( t0->m_N0->GetCoordInfo() & d_info ) == d_info &&  ( t0->m_N1->GetCoordInfo() & d_info ) == d_info
-                                    && ( t0->m_N2->GetCoordInfo() & d_info ) == d_info )
-                            {
-                                tri = t0;
-                            }
-                            else
-                            {
-                                tri = t1;
-                            }
-                            // Use Bilinear interpolation to convert edge uw points to xyz points
-                            vec3d e0xyz = tri->CompPnt( e0 );
-                            vec3d e1xyz = tri->CompPnt( e1 );
-
-                            // Create the new edges
-
-                            TEdge* ie0 = new TEdge();
-                            int info = TNode::HAS_UW | TNode::HAS_XYZ;
-                            ie0->m_N0 = new TNode();
-                            ie0->m_N0->SetUWPnt( e0 );
-                            ie0->m_N0->SetXYZPnt( e0xyz );
-                            ie0->m_N0->MakePntUW();
-                            ie0->m_N0->SetCoordInfo( info );
-                            ie0->m_N1 = new TNode();
-                            ie0->m_N1->SetUWPnt( e1 );
-                            ie0->m_N1->SetXYZPnt( e1xyz );
-                            ie0->m_N1->MakePntUW();
-                            ie0->m_N1->SetCoordInfo( info );
-
-                            TEdge* ie1 = new TEdge();
-                            ie1->m_N0 = new TNode();
-                            ie1->m_N0->SetUWPnt( e0 );
-                            ie1->m_N0->SetXYZPnt( e0xyz );
-                            ie1->m_N0->MakePntUW();
-                            ie1->m_N0->SetCoordInfo( info );
-                            ie1->m_N1 = new TNode();
-                            ie1->m_N1->SetUWPnt( e1 );
-                            ie1->m_N1->SetXYZPnt( e1xyz );
-                            ie1->m_N1->MakePntUW();
-                            ie1->m_N1->SetCoordInfo( info );
-
-                            t0->m_ISectEdgeVec.push_back( ie0 );
-                            t1->m_ISectEdgeVec.push_back( ie1 );
-
-                            if ( tri->GetTMeshPtr() )
-                            {
-                                tri->GetTMeshPtr()->SplitAliasEdges( tri, tri->m_ISectEdgeVec.back() );
-                            }
-
-                        }
-                    }
-                    else
-                    {
-                        TEdge* ie0 = new TEdge();
-                        ie0->m_N0 = new TNode();
-                        ie0->m_N0->m_Pnt = e0;
-                        ie0->m_N1 = new TNode();
-                        ie0->m_N1->m_Pnt = e1;
-
-                        TEdge* ie1 = new TEdge();
-                        ie1->m_N0 = new TNode();
-                        ie1->m_N0->m_Pnt = e0;
-                        ie1->m_N1 = new TNode();
-                        ie1->m_N1->m_Pnt = e1;
+                    return true;
+                }
+            }
+        }
+        return false;
+    } );
+}
 
+//==== Boxes Further Apart Than The Current Min Are Skipped ====//
+double TBvh::MinDistance( TBvh* iBvh, double curr_min_dist )
+{
+    TraverseLeafPairs( iBvh, curr_min_dist, [&]( int a, int b )
+    {
+        const TBvhNode & na = m_NodeVec[a];
+        const TBvhNode & nb = iBvh->m_NodeVec[b];
+        for ( int i = na.m_Index ; i < na.m_Index + na.m_Count ; i++ )
+        {
+            TTri* t0 = m_TriVec[i];
+            for ( int j = nb.m_Index ; j < nb.m_Index + nb.m_Count ; j++ )
+            {
+                TTri* t1 = iBvh->m_TriVec[j];
+                double d = tri_tri_min_dist( t0->m_N0->m_Pnt, t0->m_N1->m_Pnt, t0->m_N2->m_Pnt,
+                                             t1->m_N0->m_Pnt, t1->m_N1->m_Pnt, t1->m_N2->m_Pnt );
 
-                        if ( dist( e0, e1 ) > tol )
-                        {
-                            t0->m_ISectEdgeVec.push_back( ie0 );
-                            t1->m_ISectEdgeVec.push_back( ie1 );
-                        }
-                        else
-                        {
-                            delete ie0->m_N0;
-                            delete ie0->m_N1;
-                            delete ie1->m_N0;
-                            delete ie1->m_N1;
-                            delete ie0;
-                            delete ie1;
-                        }
-                    }
+                if ( d < curr_min_dist )
+                {
+                    curr_min_dist = d;
                 }
             }
         }
-    }
+        return false;
+    } );
+
+    return curr_min_dist;
 }
-void  TBndBox::NumCrossXRay( vec3d & orig, vector<double> & tParmVec )
-{
-    int i;
 
-    if ( orig.y() < m_Box.GetMin( 1 ) )
-    {
-        return;
-    }
-    if ( orig.y() > m_Box.GetMax( 1 ) )
-    {
-        return;
-    }
-    if ( orig.z() < m_Box.GetMin( 2 ) )
-    {
-        return;
-    }
-    if ( orig.z() > m_Box.GetMax( 2 ) )
+void TBvh::NumCrossXRay( vec3d & orig, vector<double> & tParmVec )
+{
+    if ( m_NodeVec.empty() )
     {
         return;
     }
 
-    if ( m_SBoxVec[0] )
+    vec3d dir( 1.0, 0.0, 0.0 );
+
+    int stack[TBVH_MAX_DEPTH + 2];
+    int top = 0;
+    stack[top++] = 0;
+
+    while ( top > 0 )
     {
-        for ( i = 0 ; i < 8 ; i++ )
+        const TBvhNode & n = m_NodeVec[ stack[--top] ];
+
+        if ( orig.y() < n.m_Min[1] || orig.y() > n.m_Max[1] || orig.z() < n.m_Min[2] || orig.z() > n.m_Max[2] )
         {
-            m_SBoxVec[i]->NumCrossXRay( orig, tParmVec );
+            continue;
         }
-        return;
-    }
 
-    //==== Check All Tris In Box ====//
-    double tparm, uparm, vparm;
-    vec3d dir( 1.0, 0.0, 0.0 );
-    for ( i = 0 ; i < ( int )m_TriVec.size() ; i++ )
-    {
-        TTri* tri = m_TriVec[i];
-        int iFlag = intersect_triangle( orig.v, dir.v,
-                                        tri->m_N0->m_Pnt.v, tri->m_N1->m_Pnt.v, tri->m_N2->m_Pnt.v, &tparm, &uparm, &vparm );
-
-        if ( iFlag && tparm > 0.0 )
+        if ( n.m_Count == 0 )
         {
-            //==== Find If T is Already Included ====//
-            int dupFlag = 0;
-            for ( int j = 0 ; j < ( int )tParmVec.size() ; j++ )
-            {
-                if ( std::abs( tparm - tParmVec[j] ) < 0.0000001 )
-                {
-                    dupFlag = 1;
-                    break;
-                }
-            }
+            stack[top++] = n.m_Index + 1;
+            stack[top++] = n.m_Index;
+            continue;
+        }
 
-            if ( !dupFlag )
-            {
-                tParmVec.push_back( tparm );
-            }
+        for ( int i = n.m_Index ; i < n.m_Index + n.m_Count ; i++ )
+        {
+            bvh_ray_tri( m_TriVec[i], orig, dir, tParmVec, NULL );
         }
     }
-
 }
 
-void  TBndBox::RayCast( vec3d & orig, vec3d & dir, vector<double> & tParmVec )
+void TBvh::RayCast( vec3d & orig, vec3d & dir, vector<double> & tParmVec, bool* degen_flag )
 {
-    int i;
-
-    double coord[3];
-
-    if( !intersectRayAABB( m_Box.GetMin().v, m_Box.GetMax().v, orig.v, dir.v, coord ) )
+    if ( m_NodeVec.empty() )
     {
         return;
     }
 
-    if ( m_SBoxVec[0] )
+    int stack[TBVH_MAX_DEPTH + 2];
+    int top = 0;
+    stack[top++] = 0;
+
+    while ( top > 0 )
     {
-        for ( i = 0 ; i < 8 ; i++ )
+        const TBvhNode & n = m_NodeVec[ stack[--top] ];
+
+        if ( !bvh_ray_hit( n, orig.v, dir.v ) )
         {
-            m_SBoxVec[i]->RayCast( orig, dir, tParmVec );
+            continue;
         }
-        return;
-    }
-
-    //==== Check All Tris In Box ====//
-    double tparm, uparm, vparm;
-
-    for ( i = 0 ; i < ( int )m_TriVec.size() ; i++ )
-    {
-        TTri* tri = m_TriVec[i];
-        int iFlag = intersect_triangle( orig.v, dir.v,
-                                        tri->m_N0->m_Pnt.v, tri->m_N1->m_Pnt.v, tri->m_N2->m_Pnt.v, &tparm, &uparm, &vparm );
 
-        if ( iFlag && tparm > 0.0 )
+        if ( n.m_Count == 0 )
         {
-            //==== Find If T is Already Included ====//
-            int dupFlag = 0;
-            for ( int j = 0 ; j < ( int )tParmVec.size() ; j++ )
-            {
-                if ( std::abs( tparm - tParmVec[j] ) < 0.0000001 )
-                {
-                    dupFlag = 1;
-                    break;
-                }
-            }
+            stack[top++] = n.m_Index + 1;
+            stack[top++] = n.m_Index;
+            continue;
+        }
 
-            if ( !dupFlag )
-            {
-                tParmVec.push_back( tparm );
-            }
+        for ( int i = n.m_Index ; i < n.m_Index + n.m_Count ; i++ )
+        {
+            bvh_ray_tri( m_TriVec[i], orig, dir, tParmVec, degen_flag );
         }
     }
-
 }
 
-void TBndBox::SegIntersect( vec3d & p0, vec3d & p1, vector< vec3d > & ipntVec )
+void TBvh::SegIntersect( vec3d & p0, vec3d & p1, vector< vec3d > & ipntVec )
 {
-    int i, t;
-
-    if ( !m_Box.CheckPnt( p0.x(), p0.y(), p0.z() ) && !m_Box.CheckPnt( p1.x(), p1.y(), p1.z() ) )
+    if ( m_NodeVec.empty() )
     {
         return;
     }
 
-    if ( m_SBoxVec[0] )
+    //==== Node Boxes Must Hold The Whole Segment Box To Be Skipped ====//
+    TBvhNode seg;
+    for ( int k = 0 ; k < 3 ; k++ )
     {
-        for ( i = 0 ; i < 8 ; i++ )
-        {
-            m_SBoxVec[i]->SegIntersect( p0, p1, ipntVec );
-        }
-        return;
+        seg.m_Min[k] = bvh_round_down( min( p0[k], p1[k] ) );
+        seg.m_Max[k] = bvh_round_up( max( p0[k], p1[k] ) );
     }
 
-    //==== Check All Tris In Box ====//
+    int stack[TBVH_MAX_DEPTH + 2];
+    int top = 0;
+    stack[top++] = 0;
+
     double tparm, uparm, vparm;
-    for ( t = 0 ; t < ( int )m_TriVec.size() ; t++ )
+    while ( top > 0 )
     {
-        TTri* tri = m_TriVec[t];
-        vec3d n0pnt  = tri->m_N0->m_Pnt;
-        vec3d n10pnt = tri->m_N1->m_Pnt - tri->m_N0->m_Pnt;
-        vec3d n20pnt = tri->m_N2->m_Pnt - tri->m_N0->m_Pnt;
-        vec3d p10    = p1 - p0;
-        if ( tri_seg_intersect( n0pnt,  n10pnt, n20pnt,
-                                p0, p10, uparm, vparm, tparm ) )
+        const TBvhNode & n = m_NodeVec[ stack[--top] ];
+
+        if ( !bvh_overlap( n, seg, 0.0 ) )
         {
-            vec3d pnt = p0 + ( p1 - p0 ) * tparm;
-            ipntVec.push_back( pnt );
+            continue;
+        }
+
+        if ( n.m_Count == 0 )
+        {
+            stack[top++] = n.m_Index + 1;
+            stack[top++] = n.m_Index;
+            continue;
         }
-    }
 
+        for ( int t = n.m_Index ; t < n.m_Index + n.m_Count ; t++ )
+        {
+            TTri* tri = m_TriVec[t];
+            vec3d n0pnt  = tri->m_N0->m_Pnt;
+            vec3d n10pnt = tri->m_N1->m_Pnt - tri->m_N0->m_Pnt;
+            vec3d n20pnt = tri->m_N2->m_Pnt - tri->m_N0->m_Pnt;
+            vec3d p10    = p1 - p0;
+            if ( tri_seg_intersect( n0pnt,  n10pnt, n20pnt,
+                                    p0, p10, uparm, vparm, tparm ) )
+            {
+                vec3d pnt = p0 + ( p1 - p0 ) * tparm;
+                ipntVec.push_back( pnt );
+            }
+        }
+    }
 }
 
 //===============================================//
@@ -30,6 +30,7 @@
 #include <string>
 #include <map>
 #include <list>
+#include <functional>
 using namespace std;            //jrg windows??
 
 extern "C"
@@ -40,7 +41,7 @@ extern "C"
 
 class TEdge;
 class TTri;
-class TBndBox;
+class TBvh;
 class NBndBox;
 class TMesh;
 
@@ -344,29 +345,53 @@ private:
 
 };
 
-class TBndBox
+//==== Flat BVH Node - 32 Bytes ====//
+// Interior nodes have m_Count == 0 and children m_Index and m_Index + 1.
+// Leaf nodes hold tris m_Index ... m_Index + m_Count - 1 of TBvh::m_TriVec.
+class TBvhNode
 {
 public:
-    TBndBox();
-    virtual ~TBndBox();
+    float m_Min[3];
+    float m_Max[3];
+    int m_Index;
+    int m_Count;
+};
+
+//==== Bounding Volume Hierarchy of Tris - Nodes In One Array, SAH Splits ====//
+class TBvh
+{
+public:
+    TBvh();
+    virtual ~TBvh();
 
     virtual void Reset();
 
     BndBox m_Box;
-    vector< TTri* > m_TriVec;
+    vector< TTri* > m_TriVec;       // Reordered by Build So Leaf Tris Are Contiguous
 
-    TBndBox* m_SBoxVec[8];      // Split Bnd Boxes
-
-    void SplitBox();
     void AddTri( TTri* t );
-    virtual void Intersect( TBndBox* iBox, bool UWFlag = false );
-    virtual void NumCrossXRay( vec3d & orig, vector<double> & tParmVec );
-    virtual void RayCast( vec3d & orig, vec3d & dir, vector<double> & tParmVec );
-    virtual void AddLeafNodes( vector< TBndBox* > & leafVec );
+    void Build( int num_threads = 0 );
+
+    void Intersect( TBvh* iBvh, bool UWFlag = false );
+    void NumCrossXRay( vec3d & orig, vector<double> & tParmVec );
+    // degen_flag Is Set If Any Hit Lands On A Tri Edge Or Vertex
+    void RayCast( vec3d & orig, vec3d & dir, vector<double> & tParmVec, bool* degen_flag = NULL );
+
+    void SegIntersect( vec3d & p0, vec3d & p1, vector< vec3d > & ipntVec );
+    bool CheckIntersect( TBvh* iBvh );
+    double MinDistance( TBvh* iBvh, double curr_min_dist );
+
+    int GetNumNodes()
+    {
+        return ( int )m_NodeVec.size();
+    }
+
+protected:
 
-    virtual void SegIntersect( vec3d & p0, vec3d & p1, vector< vec3d > & ipntVec );
-    virtual bool CheckIntersect( TBndBox* iBox );
-    virtual double MinDistance( TBndBox* iBox, double curr_min_dist );
+    vector< TBvhNode > m_NodeVec;
+
+    //==== Call leaf_pair( node, i_node ) For Overlapping Leaves Until It Returns True ====//
+    bool TraverseLeafPairs( TBvh* iBvh, const double & tol, const std::function< bool( int, int ) > & leaf_pair );
 
 };
 
@@ -382,7 +407,7 @@ public:
     vector< TNode* > m_NVec;
     vector< TEdge* > m_EVec;
 
-    TBndBox m_TBox;
+    TBvh m_TBox;
 
     void copy( TMesh* m );
     void CopyFlatten( TMesh* m );
@@ -421,11 +446,18 @@ public:
     double MinDistance( TMesh* tm, double curr_min_dist );
     void Split();
     void DeterIntExt( vector< TMesh* >& meshVec );
-    void DeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec );
     void MassDeterIntExt( vector< TMesh* >& meshVec );
-    void MassDeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec );
     void WaveDeterIntExt( vector< TMesh* >& meshVec );
-    void WaveDeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec );
+
+    //==== Interior/Exterior Classification Modes ====//
+    enum { DETER_INT_EXT, MASS_DETER_INT_EXT, WAVE_DETER_INT_EXT };
+
+    //==== Classify All Tris In Parallel - Split Tris Not Separated By An ISect Edge Share One Ray ====//
+    void DeterIntExtBatch( vector< TMesh* >& meshVec, int mode, int num_threads = 0 );
+
+    //==== +X Ray Parity, Winding Number If The Ray Hits An Edge Or Vertex ====//
+    bool PntInside( vec3d & orig, vec3d & dir, vector< double > & hits );
+    double WindingNumber( const vec3d & pnt );
 
     void LoadBndBox();
 
@@ -20,6 +20,18 @@
 #include "StringUtil.h"
 #include "FileUtil.h"
 
+#ifdef VSPAERO_SOLVER_LIBRARY
+#include "solver/VSPAERO_Lib.H"
+
+#include <thread>
+#ifdef WIN32
+#include <io.h>
+#include <fcntl.h>
+#else
+#include <unistd.h>
+#endif
+#endif
+
 #include <regex>
 
 //==== Constructor ====//
@@ -96,6 +108,8 @@ VSPAEROMgrSingleton::VSPAEROMgrSingleton() : ParmContainer()
     // Case Setup
     m_NCPU.Init( "NCPU", groupname, this, 4, 1, 255 );
     m_NCPU.SetDescript( "Number of processors to use" );
+    m_NumSweepWorkers.Init( "NumSweepWorkers", groupname, this, 1, 1, 255 );
+    m_NumSweepWorkers.SetDescript( "Number of vspaero processes to split a batch flight condition sweep across, each uses NCPU processors" );
 
     //    wake parameters
     m_WakeNumIter.Init( "WakeNumIter", groupname, this, 5, 1, 255 );
@@ -109,10 +123,14 @@ VSPAEROMgrSingleton::VSPAEROMgrSingleton() : ParmContainer()
     m_BatchModeFlag.SetDescript( "Flag to calculate in batch mode" );
     m_BatchModeFlag = true;
 
+    m_InProcessFlag.Init( "InProcessFlag", groupname, this, false, false, true );
+    m_InProcessFlag.SetDescript( "Flag to run the linked in solver library instead of the vspaero executable" );
+
     // This sets all the filename members to the appropriate value (for example: empty strings if there is no vehicle)
     UpdateFilenames();
 
     m_SolverProcessKill = false;
+    m_SolverInProcessRunning = false;
 
     // Plot limits
     m_ConvergenceXMinIsManual.Init( "m_ConvergenceXMinIsManual", groupname, this, 0, 0, 1 );
@@ -265,6 +283,7 @@ void VSPAEROMgrSingleton::Renew()
     m_MachStart.Set( 0.0 ); m_MachEnd.Set( 0.0 ); m_MachNpts.Set( 1 );
 
     m_BatchModeFlag.Set( true );
+    m_InProcessFlag.Set( false );
     m_Precondition.Set( vsp::PRECON_MATRIX );
     m_VortexLift.Set( true );
     m_LeadingEdgeSuction.Set( false );
@@ -274,6 +293,7 @@ void VSPAEROMgrSingleton::Renew()
     m_StabilityType.Set( vsp::STABILITY_DEFAULT );
 
     m_NCPU.Set( 4 );
+    m_NumSweepWorkers.Set( 1 );
 
     m_WakeNumIter.Set( 5 );
     m_WakeAvgStartIter.Set( 0 );
@@ -1398,29 +1418,47 @@ string VSPAEROMgrSingleton::ComputeSolverSingle( FILE * logFile )
                         MessageMgr::getInstance().Send( "ScreenMgr", NULL, data );
                     }
 
-                    // Execute VSPAero
-                    m_SolverProcess.ForkCmd( veh->GetExePath(), veh->GetVSPAEROCmd(), args );
+                    // Run the linked in solver, history and loads come straight back from memory
+                    bool solver_ok = true;
+                    if ( RunSolverInProcess( args, res_id_vector, analysisMethod, logFile, solver_ok ) )
+                    {
+                        // A failed run leaves no results, and possibly a stale stab file
+                        if ( !solver_ok )
+                        {
+                            return string();
+                        }
+
+                        if ( stabilityFlag )
+                        {
+                            ReadStabFile( stabFileName, res_id_vector, analysisMethod, stabilityType );      //*.STAB stability coeff file
+                        }
+                    }
+                    else
+                    {
+                        // Execute VSPAero
+                        m_SolverProcess.ForkCmd( veh->GetExePath(), veh->GetVSPAEROCmd(), args );
 
-                    // ==== MonitorSolverProcess ==== //
-                    MonitorSolver( logFile );
+                        // ==== MonitorSolverProcess ==== //
+                        MonitorSolver( logFile );
 
 
-                    // Check if the kill solver flag has been raised, if so clean up and return
-                    //  note: we could have exited the IsRunning loop if the process was killed
-                    if( m_SolverProcessKill )
-                    {
-                        m_SolverProcessKill = false;    //reset kill flag
+                        // Check if the kill solver flag has been raised, if so clean up and return
+                        //  note: we could have exited the IsRunning loop if the process was killed
+                        if( m_SolverProcessKill )
+                        {
+                            m_SolverProcessKill = false;    //reset kill flag
 
-                        return string();    //return empty result ID vector
-                    }
+                            return string();    //return empty result ID vector
+                        }
 
-                    //====== Read in all of the results ======//
-                    // read the files if there is new data that has not successfully been read in yet
-                    ReadHistoryFile( historyFileName, res_id_vector, analysisMethod );
-                    ReadLoadFile( loadFileName, res_id_vector, analysisMethod );
-                    if ( stabilityFlag )
-                    {
-                        ReadStabFile( stabFileName, res_id_vector, analysisMethod, stabilityType );      //*.STAB stability coeff file
+                        //====== Read in all of the results ======//
+                        // read the files if there is new data that has not successfully been read in yet
+                        ReadHistoryFile( historyFileName, res_id_vector, analysisMethod );
+                        ReadLoadFile( loadFileName, res_id_vector, analysisMethod );
+                        if ( stabilityFlag )
+                        {
+                            ReadStabFile( stabFileName, res_id_vector, analysisMethod, stabilityType );      //*.STAB stability coeff file
+                        }
                     }
 
                     // CpSlice Latest *.adb File if slices are defined
@@ -1605,28 +1643,67 @@ string VSPAEROMgrSingleton::ComputeSolverBatch( FILE * logFile )
             MessageMgr::getInstance().Send( "ScreenMgr", NULL, data );
         }
 
-        // Execute VSPAero
-        m_SolverProcess.ForkCmd( veh->GetExePath(), veh->GetVSPAEROCmd(), args );
+        // Run the linked in solver, history and loads come straight back from memory
+        bool solver_ok = true;
+        if ( RunSolverInProcess( args, res_id_vector, analysisMethod, logFile, solver_ok ) )
+        {
+            // A failed run leaves no results, and possibly a stale stab file
+            if ( !solver_ok )
+            {
+                return string();
+            }
 
-        // ==== MonitorSolverProcess ==== //
-        MonitorSolver( logFile );
+            if ( stabilityFlag )
+            {
+                ReadStabFile( stabFileName, res_id_vector, analysisMethod, stabilityType );      //*.STAB stability coeff file
+            }
+        }
+        else
+        {
+            // Independent flight conditions can be split across several vspaero
+            // processes, stability and 2D FEM runs still need the whole sweep in one
+            int nworkers = m_NumSweepWorkers();
+            int ncases = ( int )( machVec.size() * alphaVec.size() * betaVec.size() );
+            if ( nworkers > ncases )
+            {
+                nworkers = ncases;
+            }
 
+            if ( nworkers > 1 && !stabilityFlag && !m_Write2DFEMFlag() )
+            {
+                // A failed sweep leaves no merged results to read, the reason
+                // has already been sent on with the solver output
+                if ( !RunSolverSweep( args, nworkers, logFile ) && !m_SolverProcessKill )
+                {
+                    return string();
+                }
+            }
+            else
+            {
+                // Execute VSPAero
+                m_SolverProcess.ForkCmd( veh->GetExePath(), veh->GetVSPAEROCmd(), args );
 
-        // Check if the kill solver flag has been raised, if so clean up and return
-        //  note: we could have exited the IsRunning loop if the process was killed
-        if( m_SolverProcessKill )
-        {
-            m_SolverProcessKill = false;    //reset kill flag
+                // ==== MonitorSolverProcess ==== //
+                MonitorSolver( logFile );
+            }
 
-            return string();    //return empty result ID vector
-        }
 
-        //====== Read in all of the results ======//
-        ReadHistoryFile( historyFileName, res_id_vector, analysisMethod );
-        ReadLoadFile( loadFileName, res_id_vector, analysisMethod );
-        if ( stabilityFlag )
-        {
-            ReadStabFile( stabFileName, res_id_vector, analysisMethod, stabilityType );      //*.STAB stability coeff file
+            // Check if the kill solver flag has been raised, if so clean up and return
+            //  note: we could have exited the IsRunning loop if the process was killed
+            if( m_SolverProcessKill )
+            {
+                m_SolverProcessKill = false;    //reset kill flag
+
+                return string();    //return empty result ID vector
+            }
+
+            //====== Read in all of the results ======//
+            ReadHistoryFile( historyFileName, res_id_vector, analysisMethod );
+            ReadLoadFile( loadFileName, res_id_vector, analysisMethod );
+            if ( stabilityFlag )
+            {
+                ReadStabFile( stabFileName, res_id_vector, analysisMethod, stabilityType );      //*.STAB stability coeff file
+            }
         }
 
         // CpSlice *.adb File and slices are defined
@@ -1691,6 +1768,558 @@ void VSPAEROMgrSingleton::MonitorSolver( FILE * logFile )
     }
 }
 
+// Solver output goes to the log file when there is one, otherwise to the GUI
+static void SendSolverMessage( FILE * logFile, const string &msg )
+{
+    if( logFile )
+    {
+        fprintf( logFile, "%s", msg.c_str() );
+    }
+    else
+    {
+        MessageData data;
+        data.m_String = "VSPAEROSolverMessage";
+        data.m_StringVec.push_back( msg );
+        MessageMgr::getInstance().Send( "ScreenMgr", NULL, data );
+    }
+}
+
+// Run a batch sweep as nworkers concurrent vspaero processes.  A setup pass
+// writes the setup cache first, each worker then loads it read only and solves
+// its own contiguous block of flight conditions.  A final merge pass puts the
+// worker outputs back together, in case order, under the usual file names.
+// Returns false, after reporting why, if any pass fails.
+bool VSPAEROMgrSingleton::RunSolverSweep( const vector<string> &args, int nworkers, FILE * logFile )
+{
+    Vehicle *veh = VehicleMgr.GetVehicle();
+    if ( !veh || args.empty() )
+    {
+        return false;
+    }
+
+    string nworkers_str = StringUtil::int_to_string( nworkers, "%d" );
+
+    // Worker arguments go in front of the model file name, which must be last
+    vector < string > sweep_args = args;
+    sweep_args.insert( sweep_args.end() - 1, "-setupcache" );
+    sweep_args.insert( sweep_args.end() - 1, "-sweep" );
+    sweep_args.insert( sweep_args.end() - 1, "0" );
+    sweep_args.insert( sweep_args.end() - 1, nworkers_str );
+
+    // ==== Setup pass ==== //
+    m_SolverProcess.ForkCmd( veh->GetExePath(), veh->GetVSPAEROCmd(), sweep_args );
+    MonitorSolver( logFile );
+
+    if ( m_SolverProcessKill )
+    {
+        return false;
+    }
+
+    if ( m_SolverProcess.GetExitStatus() != 0 )
+    {
+        char str[256];
+        sprintf( str, "\nVSPAERO sweep setup pass failed with exit status %d\n", m_SolverProcess.GetExitStatus() );
+        SendSolverMessage( logFile, string( str ) );
+        return false;
+    }
+
+    // ==== Workers ==== //
+    m_SweepWorkerProcess.clear();
+    m_SweepWorkerProcess.resize( nworkers );
+
+    for ( int i = 0; i < nworkers; i++ )
+    {
+        sweep_args[ sweep_args.size() - 3 ] = StringUtil::int_to_string( i + 1, "%d" );
+        m_SweepWorkerProcess[i].ForkCmd( veh->GetExePath(), veh->GetVSPAEROCmd(), sweep_args );
+    }
+
+    bool workers_ok = MonitorSweepWorkers( logFile );
+
+    if ( m_SolverProcessKill || !workers_ok )
+    {
+        return false;
+    }
+
+    // ==== Merge pass ==== //
+    vector < string > merge_args = args;
+    merge_args.insert( merge_args.end() - 1, "-sweepmerge" );
+    merge_args.insert( merge_args.end() - 1, nworkers_str );
+
+    m_SolverProcess.ForkCmd( veh->GetExePath(), veh->GetVSPAEROCmd(), merge_args );
+    MonitorSolver( logFile );
+
+    if ( !m_SolverProcessKill && m_SolverProcess.GetExitStatus() != 0 )
+    {
+        char str[256];
+        sprintf( str, "\nVSPAERO sweep merge failed with exit status %d, the worker output files were kept\n", m_SolverProcess.GetExitStatus() );
+        SendSolverMessage( logFile, string( str ) );
+        return false;
+    }
+
+    return true;
+}
+
+// Same as MonitorSolver, but over all of the sweep workers.  Each worker's
+// output is passed on a whole line at a time, tagged with the worker number,
+// so the interleaved output stays readable.  Returns false, after reporting
+// which workers failed, if any worker did not exit cleanly.
+bool VSPAEROMgrSingleton::MonitorSweepWorkers( FILE * logFile )
+{
+    int bufsize = 1000;
+    char *buf;
+    buf = ( char* ) malloc( sizeof( char ) * ( bufsize + 1 ) );
+
+    int nworkers = ( int )m_SweepWorkerProcess.size();
+
+    vector < unsigned long > nread( nworkers, 1 );
+    vector < bool > runflag( nworkers, true );
+    vector < string > partial( nworkers );
+
+    bool anyflag = true;
+    while ( anyflag )
+    {
+        anyflag = false;
+
+        for ( int i = 0; i < nworkers; i++ )
+        {
+            if ( !runflag[i] && nread[i] == 0 )
+            {
+                continue;
+            }
+
+            m_SweepWorkerProcess[i].ReadStdoutPipe( buf, bufsize, &nread[i] );
+            if( nread[i] > 0 && nread[i] != ( unsigned long ) - 1 )
+            {
+                if ( buf )
+                {
+                    buf[nread[i]] = 0;
+                    StringUtil::change_from_to( buf, '\r', '\n' );
+                    partial[i] += string( buf );
+
+                    string lines;
+                    size_t eol;
+                    while ( ( eol = partial[i].find( '\n' ) ) != string::npos )
+                    {
+                        lines += "Worker " + StringUtil::int_to_string( i + 1, "%d" ) + ": " + partial[i].substr( 0, eol + 1 );
+                        partial[i].erase( 0, eol + 1 );
+                    }
+
+                    if ( !lines.empty() )
+                    {
+                        SendSolverMessage( logFile, lines );
+                    }
+                }
+            }
+            else
+            {
+                nread[i] = 0;
+            }
+
+            runflag[i] = m_SweepWorkerProcess[i].IsRunning();
+            anyflag = anyflag || runflag[i] || nread[i] > 0;
+        }
+
+        SleepForMilliseconds( 100 );
+    }
+
+    free( buf );
+
+    bool ok = true;
+    for ( int i = 0; i < nworkers; i++ )
+    {
+        if ( !partial[i].empty() )
+        {
+            SendSolverMessage( logFile, "Worker " + StringUtil::int_to_string( i + 1, "%d" ) + ": " + partial[i] + "\n" );
+        }
+
+        if ( m_SweepWorkerProcess[i].GetExitStatus() != 0 && !m_SolverProcessKill )
+        {
+            char str[256];
+            sprintf( str, "\nVSPAERO sweep worker %d of %d failed with exit status %d\n", i + 1, nworkers, m_SweepWorkerProcess[i].GetExitStatus() );
+            SendSolverMessage( logFile, string( str ) );
+            ok = false;
+        }
+    }
+
+    return ok;
+}
+
+#ifdef VSPAERO_SOLVER_LIBRARY
+// Flow condition header for a case run in process, same names as ReadVSPAEROCaseHeader reads
+static void AddLibCaseHeader( Results * res, VSPAERO_LIB_CASE & lib_case )
+{
+    for ( int i = 1; i <= lib_case.NumberOfHeaderValues(); i++ )
+    {
+        res->Add( NameValData( "FC_" + string( lib_case.HeaderName( i ) ), lib_case.HeaderValue( i ) ) );
+    }
+}
+
+// The linked in solver prints its progress to stdout.  While it runs stdout is
+// pointed at a pipe, and a reader thread passes the text on to the log file or
+// GUI the same way MonitorSolver does for the executable.  A log file that is
+// stdout itself is written through the saved descriptor, never back into the
+// pipe.  If stdout can't be redirected the solver just runs uncaptured.
+class SolverOutputCapture
+{
+public:
+    SolverOutputCapture( FILE * logFile )
+    {
+        m_SavedFd = -1;
+
+        int out_fd = FileNo( stdout );
+        if ( out_fd < 0 )
+        {
+            return;
+        }
+
+        int fds[2];
+#ifdef WIN32
+        if ( _pipe( fds, 4096, _O_BINARY ) != 0 )
+#else
+        if ( pipe( fds ) != 0 )
+#endif
+        {
+            return;
+        }
+
+        fflush( stdout );
+        if ( logFile )
+        {
+            fflush( logFile );
+        }
+
+#ifdef WIN32
+        m_SavedFd = _dup( out_fd );
+        if ( m_SavedFd < 0 || _dup2( fds[1], out_fd ) != 0 )
+#else
+        m_SavedFd = dup( out_fd );
+        if ( m_SavedFd < 0 || dup2( fds[1], out_fd ) < 0 )
+#endif
+        {
+            if ( m_SavedFd >= 0 )
+            {
+                Close( m_SavedFd );
+                m_SavedFd = -1;
+            }
+            Close( fds[0] );
+            Close( fds[1] );
+            return;
+        }
+        Close( fds[1] );
+
+        // While the redirect is active stdout is the pipe, so its text goes out the saved descriptor
+        int log_fd = -1;
+        if ( logFile && FileNo( logFile ) == out_fd )
+        {
+            log_fd = m_SavedFd;
+        }
+
+        int read_fd = fds[0];
+        m_Reader = std::thread( [ logFile, log_fd, read_fd ]()
+        {
+            char buf[1001];
+            int nread;
+#ifdef WIN32
+            while ( ( nread = _read( read_fd, buf, 1000 ) ) > 0 )
+#else
+            while ( ( nread = ( int )read( read_fd, buf, 1000 ) ) > 0 )
+#endif
+            {
+                buf[nread] = 0;
+                StringUtil::change_from_to( buf, '\r', '\n' );
+                if ( log_fd >= 0 )
+                {
+                    WriteAll( log_fd, buf, nread );
+                }
+                else
+                {
+                    SendSolverMessage( logFile, string( buf ) );
+                }
+            }
+            Close( read_fd );
+        } );
+    }
+
+    // Putting stdout back closes the last write end of the pipe, so the reader
+    // sees the end of the output and finishes
+    ~SolverOutputCapture()
+    {
+        if ( m_SavedFd < 0 )
+        {
+            return;
+        }
+
+        fflush( stdout );
+#ifdef WIN32
+        _dup2( m_SavedFd, FileNo( stdout ) );
+#else
+        dup2( m_SavedFd, FileNo( stdout ) );
+#endif
+
+        if ( m_Reader.joinable() )
+        {
+            m_Reader.join();
+        }
+        Close( m_SavedFd );
+    }
+
+private:
+    static int FileNo( FILE * fp )
+    {
+#ifdef WIN32
+        return _fileno( fp );
+#else
+        return fileno( fp );
+#endif
+    }
+
+    static void Close( int fd )
+    {
+#ifdef WIN32
+        _close( fd );
+#else
+        close( fd );
+#endif
+    }
+
+    static void WriteAll( int fd, const char * buf, int n )
+    {
+        while ( n > 0 )
+        {
+#ifdef WIN32
+            int nwrite = _write( fd, buf, n );
+#else
+            int nwrite = ( int )write( fd, buf, n );
+#endif
+            if ( nwrite <= 0 )
+            {
+                return;
+            }
+            buf += nwrite;
+            n -= nwrite;
+        }
+    }
+
+    int m_SavedFd;
+    std::thread m_Reader;
+};
+#endif
+
+// Run the solver linked into this program.  Returns false, leaving the work to
+// the vspaero executable, when the library is not built in, the in process
+// flag is off, or the run is time accurate.  Otherwise returns true, with
+// solver_ok false and no results added if the solver failed.
+bool VSPAEROMgrSingleton::RunSolverInProcess( vector<string> &args, vector <string> &res_id_vector, vsp::VSPAERO_ANALYSIS_METHOD analysisMethod, FILE * logFile, bool &solver_ok )
+{
+    solver_ok = true;
+
+#ifdef VSPAERO_SOLVER_LIBRARY
+    if ( !m_InProcessFlag() )
+    {
+        return false;
+    }
+
+    // Unsteady P, Q and R runs only write their history to the files
+    if ( m_StabilityCalcFlag() && m_StabilityType() != vsp::STABILITY_DEFAULT )
+    {
+        return false;
+    }
+
+    // Same command line the executable gets, the copies must outlive the run
+    vector < string > arg_copy = args;
+    arg_copy.insert( arg_copy.begin(), string( "vspaero" ) );
+
+    vector < char* > argv( arg_copy.size() + 1, ( char* ) NULL );
+    for ( int i = 0; i < ( int )arg_copy.size(); i++ )
+    {
+        argv[i] = &arg_copy[i][0];
+    }
+
+    // Vortex lattice geometry comes from the DegenGeom already in memory, the
+    // panel method still reads its tri file.  If the stream can't be opened the
+    // solver falls back to the csv written by ComputeGeometry.
+    char *degen_buf = NULL;
+    FILE *degen_fp = NULL;
+    if ( analysisMethod == vsp::VORTEX_LATTICE )
+    {
+        degen_fp = OpenDegenGeomStream( &degen_buf );
+    }
+
+    VSPAERO_LIB_RESULTS lib_res;
+
+    int solver_status;
+
+    m_SolverInProcessRunning = true;
+    {
+        SolverOutputCapture capture( logFile );
+        solver_status = VSPAERO_Run( ( int )arg_copy.size(), &argv[0], degen_fp, &lib_res );
+    }
+    m_SolverInProcessRunning = false;
+
+    if ( degen_fp )
+    {
+        fclose( degen_fp );
+    }
+    free( degen_buf );
+
+    if ( solver_status != 0 )
+    {
+        char str[256];
+        sprintf( str, "\nVSPAERO solver failed with exit status %d\n", solver_status );
+        SendSolverMessage( logFile, string( str ) );
+        solver_ok = false;
+        return true;
+    }
+
+    // Same results, in the same order, as ReadHistoryFile followed by ReadLoadFile
+    for ( int c = 1; c <= lib_res.NumberOfCases(); c++ )
+    {
+        VSPAERO_LIB_CASE & lib_case = lib_res.Case( c );
+
+        Results* res = ResultsMgr.CreateResults( "VSPAERO_History" );
+        res_id_vector.push_back( res->GetID() );
+
+        AddLibCaseHeader( res, lib_case );
+        AddResultHeader( res->GetID(), lib_case.Header( "Mach_" ), lib_case.Header( "AoA_" ), lib_case.Header( "Beta_" ), analysisMethod );
+
+        int nrow = lib_case.NumberOfHistoryRows();
+
+        std::vector<int> i( nrow );
+        std::vector< std::vector<double> > col( VSPAERO_LIB_NUMBER_OF_HISTORY_COLUMNS + 1, std::vector<double>( nrow ) );
+
+        for ( int r = 0; r < nrow; r++ )
+        {
+            i[r] = ( int )lib_case.History( r + 1, 1 );
+
+            for ( int k = 2; k <= VSPAERO_LIB_NUMBER_OF_HISTORY_COLUMNS; k++ )
+            {
+                col[k][r] = lib_case.History( r + 1, k );
+            }
+        }
+
+        res->Add( NameValData( "WakeIter", i ) );
+        res->Add( NameValData( "Mach", col[2] ) );
+        res->Add( NameValData( "Alpha", col[3] ) );
+        res->Add( NameValData( "Beta", col[4] ) );
+        res->Add( NameValData( "CL", col[5] ) );
+        res->Add( NameValData( "CDo", col[6] ) );
+        res->Add( NameValData( "CDi", col[7] ) );
+        res->Add( NameValData( "CDtot", col[8] ) );
+        res->Add( NameValData( "CS", col[9] ) );
+        res->Add( NameValData( "L/D", col[10] ) );
+        res->Add( NameValData( "E", col[11] ) );
+        res->Add( NameValData( "CFx", col[12] ) );
+        res->Add( NameValData( "CFy", col[13] ) );
+        res->Add( NameValData( "CFz", col[14] ) );
+        res->Add( NameValData( "CMx", col[15] ) );
+        res->Add( NameValData( "CMy", col[16] ) );
+        res->Add( NameValData( "CMz", col[17] ) );
+        res->Add( NameValData( "T/QS", col[18] ) );
+    }
+
+    for ( int c = 1; c <= lib_res.NumberOfCases(); c++ )
+    {
+        VSPAERO_LIB_CASE & lib_case = lib_res.Case( c );
+
+        Results* res = ResultsMgr.CreateResults( "VSPAERO_Load" );
+        res_id_vector.push_back( res->GetID() );
+
+        AddLibCaseHeader( res, lib_case );
+        AddResultHeader( res->GetID(), lib_case.Header( "Mach_" ), lib_case.Header( "AoA_" ), lib_case.Header( "Beta_" ), analysisMethod );
+
+        double cref = lib_case.Header( "Cref_" );
+
+        int nrow = lib_case.NumberOfLoadRows();
+
+        std::vector<int> WingId( nrow );
+        std::vector< std::vector<double> > col( VSPAERO_LIB_NUMBER_OF_LOAD_COLUMNS + 1, std::vector<double>( nrow ) );
+        std::vector< std::vector<double> > colc( VSPAERO_LIB_NUMBER_OF_LOAD_COLUMNS + 1, std::vector<double>( nrow ) );
+
+        for ( int r = 0; r < nrow; r++ )
+        {
+            WingId[r] = ( int )lib_case.Load( r + 1, 1 );
+
+            for ( int k = 2; k <= VSPAERO_LIB_NUMBER_OF_LOAD_COLUMNS; k++ )
+            {
+                col[k][r] = lib_case.Load( r + 1, k );
+            }
+
+            // Normalized by local chord
+            double chordRatio = col[3][r] / cref;
+
+            for ( int k = 5; k <= VSPAERO_LIB_NUMBER_OF_LOAD_COLUMNS; k++ )
+            {
+                colc[k][r] = col[k][r] * chordRatio;
+            }
+        }
+
+        res->Add( NameValData( "WingId", WingId ) );
+        res->Add( NameValData( "Yavg", col[2] ) );
+        res->Add( NameValData( "Chord", col[3] ) );
+        res->Add( NameValData( "V/Vinf", col[4] ) );
+        res->Add( NameValData( "cl", col[5] ) );
+        res->Add( NameValData( "cd", col[6] ) );
+        res->Add( NameValData( "cs", col[7] ) );
+        res->Add( NameValData( "cx", col[8] ) );
+        res->Add( NameValData( "cy", col[9] ) );
+        res->Add( NameValData( "cz", col[10] ) );
+        res->Add( NameValData( "cmx", col[11] ) );
+        res->Add( NameValData( "cmy", col[12] ) );
+        res->Add( NameValData( "cmz", col[13] ) );
+
+        res->Add( NameValData( "cl*c/cref", colc[5] ) );
+        res->Add( NameValData( "cd*c/cref", colc[6] ) );
+        res->Add( NameValData( "cs*c/cref", colc[7] ) );
+        res->Add( NameValData( "cx*c/cref", colc[8] ) );
+        res->Add( NameValData( "cy*c/cref", colc[9] ) );
+        res->Add( NameValData( "cz*c/cref", colc[10] ) );
+        res->Add( NameValData( "cmx*c/cref", colc[11] ) );
+        res->Add( NameValData( "cmy*c/cref", colc[12] ) );
+        res->Add( NameValData( "cmz*c/cref", colc[13] ) );
+    }
+
+    return true;
+#else
+    return false;
+#endif
+}
+
+// Write the DegenGeom csv data, with the same writer Vehicle::WriteDegenGeomFile
+// uses, to a stream in memory and open it for reading.  The caller frees buf once the stream is
+// closed.
+FILE* VSPAEROMgrSingleton::OpenDegenGeomStream( char ** buf )
+{
+    FILE *fp = NULL;
+    *buf = NULL;
+
+#ifdef WIN32
+    // No memory streams, an anonymous temporary file is the closest we have
+    fp = tmpfile();
+    if ( !fp )
+    {
+        return NULL;
+    }
+#else
+    size_t len = 0;
+    fp = open_memstream( buf, &len );
+    if ( !fp )
+    {
+        return NULL;
+    }
+#endif
+
+    VehicleMgr.GetVehicle()->WriteDegenGeomCsvFile( fp );
+
+#ifdef WIN32
+    rewind( fp );
+#else
+    fclose( fp );
+    fp = fmemopen( *buf, len, "r" );
+#endif
+
+    return fp;
+}
+
 void VSPAEROMgrSingleton::AddResultHeader( string res_id, double mach, double alpha, double beta, vsp::VSPAERO_ANALYSIS_METHOD analysisMethod )
 {
     // Add Flow Condition header to each result
@@ -1704,13 +2333,25 @@ void VSPAEROMgrSingleton::AddResultHeader( string res_id, double mach, double al
 // helper thread functions for VSPAERO GUI interface and multi-threaded impleentation
 bool VSPAEROMgrSingleton::IsSolverRunning()
 {
-    return m_SolverProcess.IsRunning();
+    for ( int i = 0; i < ( int )m_SweepWorkerProcess.size(); i++ )
+    {
+        if ( m_SweepWorkerProcess[i].IsRunning() )
+        {
+            return true;
+        }
+    }
+
+    return m_SolverProcess.IsRunning() || m_SolverInProcessRunning;
 }
 
 void VSPAEROMgrSingleton::KillSolver()
 {
     // Raise flag to break the compute solver thread
     m_SolverProcessKill = true;
+    for ( int i = 0; i < ( int )m_SweepWorkerProcess.size(); i++ )
+    {
+        m_SweepWorkerProcess[i].Kill();
+    }
     return m_SolverProcess.Kill();
 }
 
@@ -2068,7 +2709,7 @@ void VSPAEROMgrSingleton::ReadLoadFile( string filename, vector <string> &res_id
             res->Add( NameValData( "WingId", WingId ) );
             res->Add( NameValData( "Yavg", Yavg ) );
             res->Add( NameValData( "Chord", Chord ) );
-            res->Add( NameValData( "V/Vinf", Chord ) );
+            res->Add( NameValData( "V/Vinf", VoVinf ) );
             res->Add( NameValData( "cl", Cl ) );
             res->Add( NameValData( "cd", Cd ) );
             res->Add( NameValData( "cs", Cs ) );
@@ -283,6 +283,7 @@ public:
     IntParm m_RefFlag;
 
     BoolParm m_BatchModeFlag;
+    BoolParm m_InProcessFlag;
 
     // Mass Properties Parms
     IntParm m_CGGeomSet;
@@ -298,6 +299,7 @@ public:
 
     // Solver settings
     IntParm m_NCPU;
+    IntParm m_NumSweepWorkers;
     IntParm m_WakeNumIter;
     IntParm m_WakeAvgStartIter;
     IntParm m_WakeSkipUntilIter;
@@ -373,6 +375,7 @@ public:
     Parm m_UnsteadyYMax;
 
     ProcessUtil m_SolverProcess;
+    vector < ProcessUtil > m_SweepWorkerProcess;
     ProcessUtil m_SlicerThread;
 
 protected:
@@ -388,8 +391,15 @@ protected:
     void GetSweepVectors( vector<double> &alphaVec, vector<double> &betaVec, vector<double> &machVec );
 
     void MonitorSolver( FILE * logFile );
+    bool RunSolverSweep( const vector<string> &args, int nworkers, FILE * logFile );
+    bool MonitorSweepWorkers( FILE * logFile );
     bool m_SolverProcessKill;
 
+    // Solver linked in as a library, fed the DegenGeom data and read back from memory
+    bool RunSolverInProcess( vector<string> &args, vector <string> &res_id_vector, vsp::VSPAERO_ANALYSIS_METHOD analysisMethod, FILE * logFile, bool &solver_ok );
+    FILE* OpenDegenGeomStream( char ** buf );
+    bool m_SolverInProcessRunning;
+
     // helper functions for VSPAERO files
     void ReadHistoryFile( string filename, vector <string> &res_id_vector, vsp::VSPAERO_ANALYSIS_METHOD analysisMethod );
     void ReadLoadFile( string filename, vector <string> &res_id_vector, vsp::VSPAERO_ANALYSIS_METHOD analysisMethod );
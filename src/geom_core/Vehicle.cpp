@@ -28,6 +28,7 @@
 #include "ParasiteDragMgr.h"
 #include "Quat.h"
 #include "StringUtil.h"
+#include "Util.h"
 #include "SubSurfaceMgr.h"
 #include "StructureMgr.h"
 #include "DesignVarMgr.h"
@@ -38,11 +39,16 @@
 #include "VarPresetMgr.h"
 #include "VSPAEROMgr.h"
 #include "WireGeom.h"
+#include "ThreadPool.h"
+#include "ProcessUtil.h"
 #include "main.h"
 
 #include "ProjectionMgr.h"
 #include "DXFUtil.h"
 #include "DegenGeom.h"
+#include "SurfProjector.h"
+
+#include <chrono>
 
 using namespace vsp;
 
@@ -125,6 +131,15 @@ Vehicle::Vehicle()
     m_STLMultiSolid.Init( "MultiSolid", "STLSettings", this, false, 0, 1 );
 
     m_UpdatingBBox = false;
+    ResetUpdateStats();
+    m_UpdateThreads = 0;
+
+    m_DegenMeshTime = 0;
+    m_DegenPeakMem = 0;
+    m_DegenPeakMemGrowth = 0;
+    m_DegenSetHash = 0;
+    m_CompGeomHash = 0;
+
     m_BbXLen.Init( "X_Len", "BBox", this, 0, 0, 1e12 );
     m_BbXLen.SetDescript( "X length of vehicle bounding box" );
     m_BbYLen.Init( "Y_Len", "BBox", this, 0, 0, 1e12 );
@@ -142,6 +157,7 @@ Vehicle::Vehicle()
     m_exportDragBuildTsvFile.Init( "DragBuild_TSV_Export", "ExportFlag", this, true, 0, 1 );
     m_exportDegenGeomCsvFile.Init( "DegenGeom_CSV_Export", "ExportFlag", this, true, 0, 1 );
     m_exportDegenGeomMFile.Init( "DegenGeom_M_Export", "ExportFlag", this, true, 0, 1 );
+    m_exportDegenGeomBinFile.Init( "DegenGeom_Bin_Export", "ExportFlag", this, false, 0, 1 );
 
     m_AxisLength.Init( "AxisLength", "Axis", this, 1.0, 1e-12, 1e12 );
     m_AxisLength.SetDescript( "Length of axis icon displayed on screen" );
@@ -293,6 +309,7 @@ void Vehicle::Init()
     m_exportDragBuildTsvFile.Set( true );
     m_exportDegenGeomCsvFile.Set( true );
     m_exportDegenGeomMFile.Set( true );
+    m_exportDegenGeomBinFile.Set( false );
 
     AnalysisMgr.Init();
 }
@@ -349,6 +366,8 @@ void Vehicle::Wype()
 
     m_ExportFileNames.clear();
 
+    ClearGeomResultsCache();
+
     // Clear out various managers...
     LinkMgr.Renew();
     AdvLinkMgr.Renew();
@@ -447,16 +466,223 @@ void Vehicle::UnDo()
 //===== Update All Geometry ====//
 void Vehicle::Update( bool fullupdate )
 {
-    for ( int i = 0 ; i < ( int )m_TopGeom.size() ; i++ )
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    vector< Geom* > top_vec = FindGeomVec( m_TopGeom );
+
+    //==== Trees No Link Or Script Reaches Into Update On Separate Threads ====//
+    vector< bool > done_vec( top_vec.size(), false );
+    if ( m_UpdateThreads != 1 && top_vec.size() > 1 )
     {
-        Geom* g_ptr = FindGeom( m_TopGeom[i] );
-        if ( g_ptr )
+        std::set< string > linked_set;
+        FindLinkedTopGeoms( linked_set );
+
+        vector< Geom* > thread_vec;
+        for ( int i = 0 ; i < ( int )top_vec.size() ; i++ )
+        {
+            if ( linked_set.count( top_vec[i]->GetID() ) == 0 && IsTreeThreadSafe( top_vec[i] ) &&
+                 IsTreeDirty( top_vec[i], fullupdate ) )
+            {
+                thread_vec.push_back( top_vec[i] );
+                done_vec[i] = true;
+            }
+        }
+
+        if ( thread_vec.size() > 1 )
+        {
+            ThreadPool pool( m_UpdateThreads );
+            pool.Run( ( int )thread_vec.size(), [&]( int i )
+            {
+                UpdateDirty( thread_vec[i], fullupdate );
+            } );
+        }
+        else if ( thread_vec.size() == 1 )
+        {
+            UpdateDirty( thread_vec[0], fullupdate );
+        }
+    }
+
+    //==== Linked Trees Update In Order ====//
+    for ( int i = 0 ; i < ( int )top_vec.size() ; i++ )
+    {
+        if ( !done_vec[i] )
         {
-            g_ptr->Update( fullupdate );
+            UpdateDirty( top_vec[i], fullupdate );
         }
     }
 
     MeasureMgr.Update();
+
+    m_UpdateTime += std::chrono::duration< double >( std::chrono::steady_clock::now() - start ).count();
+}
+
+//==== Update Geoms Reached By A Change - A Dirty Geom Updates Its Whole Subtree ====//
+void Vehicle::UpdateDirty( Geom* geom_ptr, bool fullupdate )
+{
+    if ( geom_ptr->IsDirty( fullupdate ) )
+    {
+        geom_ptr->Update( fullupdate );
+        return;
+    }
+
+    CountGeomSkip();
+
+    vector< string > child_id_vec = geom_ptr->GetChildIDVec();
+    for ( int i = 0 ; i < ( int )child_id_vec.size() ; i++ )
+    {
+        Geom* child = FindGeom( child_id_vec[i] );
+        if ( child )
+        {
+            child->SetIgnoreAbsFlag( true );
+            UpdateDirty( child, fullupdate );
+            child->SetIgnoreAbsFlag( false );
+        }
+    }
+}
+
+//==== Check If Any Geom In Tree Needs An Update ====//
+bool Vehicle::IsTreeDirty( Geom* geom_ptr, bool fullupdate )
+{
+    if ( geom_ptr->IsDirty( fullupdate ) )
+    {
+        return true;
+    }
+
+    vector< string > child_id_vec = geom_ptr->GetChildIDVec();
+    for ( int i = 0 ; i < ( int )child_id_vec.size() ; i++ )
+    {
+        Geom* child = FindGeom( child_id_vec[i] );
+        if ( child && IsTreeDirty( child, fullupdate ) )
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+//==== Custom Geoms Run Scripts And Must Stay On The Main Thread ====//
+bool Vehicle::IsTreeThreadSafe( Geom* geom_ptr )
+{
+    if ( geom_ptr->GetType().m_Type == CUSTOM_GEOM_TYPE )
+    {
+        return false;
+    }
+
+    vector< string > child_id_vec = geom_ptr->GetChildIDVec();
+    for ( int i = 0 ; i < ( int )child_id_vec.size() ; i++ )
+    {
+        Geom* child = FindGeom( child_id_vec[i] );
+        if ( child && !IsTreeThreadSafe( child ) )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//==== Find Top Of Geom Tree ====//
+Geom* Vehicle::FindTopGeom( Geom* geom_ptr )
+{
+    Geom* parent = FindGeom( geom_ptr->GetParentID() );
+    while ( parent && parent != geom_ptr )
+    {
+        geom_ptr = parent;
+        parent = FindGeom( geom_ptr->GetParentID() );
+    }
+    return geom_ptr;
+}
+
+//==== Find Top Geoms Of Trees Holding A Linked Or Adv Linked Parm ====//
+void Vehicle::FindLinkedTopGeoms( std::set< string > & top_id_set )
+{
+    vector< string > parm_id_vec;
+    for ( int i = 0 ; i < LinkMgr.GetNumLinks() ; i++ )
+    {
+        Link* pl = LinkMgr.GetLink( i );
+        if ( pl )
+        {
+            parm_id_vec.push_back( pl->GetParmA() );
+            parm_id_vec.push_back( pl->GetParmB() );
+        }
+    }
+
+    vector< AdvLink* > adv_link_vec = AdvLinkMgr.GetLinks();
+    for ( int i = 0 ; i < ( int )adv_link_vec.size() ; i++ )
+    {
+        vector< VarDef > in_vec = adv_link_vec[i]->GetInputVars();
+        for ( int j = 0 ; j < ( int )in_vec.size() ; j++ )
+        {
+            parm_id_vec.push_back( in_vec[j].m_ParmID );
+        }
+
+        vector< VarDef > out_vec = adv_link_vec[i]->GetOutputVars();
+        for ( int j = 0 ; j < ( int )out_vec.size() ; j++ )
+        {
+            parm_id_vec.push_back( out_vec[j].m_ParmID );
+        }
+    }
+
+    for ( int i = 0 ; i < ( int )parm_id_vec.size() ; i++ )
+    {
+        Parm* p = ParmMgr.FindParm( parm_id_vec[i] );
+        if ( !p )
+        {
+            continue;
+        }
+
+        // XSec, XSecSurf and SubSurface parms reach their Geom through parent containers
+        ParmContainer* pc = p->GetContainer();
+        while ( pc )
+        {
+            Geom* geom_ptr = FindGeom( pc->GetID() );
+            if ( geom_ptr )
+            {
+                top_id_set.insert( FindTopGeom( geom_ptr )->GetID() );
+                break;
+            }
+            ParmContainer* parent = pc->GetParentContainerPtr();
+            pc = ( parent != pc ) ? parent : NULL;
+        }
+    }
+}
+
+void Vehicle::CountGeomSkip()
+{
+    std::lock_guard< std::mutex > lock( m_UpdateStatsMutex );
+    m_NumSkippedUpdates++;
+}
+
+void Vehicle::CountGeomUpdate( bool surf_flag )
+{
+    std::lock_guard< std::mutex > lock( m_UpdateStatsMutex );
+    if ( surf_flag )
+    {
+        m_NumSurfUpdates++;
+    }
+    else
+    {
+        m_NumXFormUpdates++;
+    }
+}
+
+void Vehicle::ResetUpdateStats()
+{
+    m_NumSurfUpdates = 0;
+    m_NumXFormUpdates = 0;
+    m_NumSkippedUpdates = 0;
+    m_UpdateTime = 0.0;
+}
+
+string Vehicle::CreateUpdateStatsResults()
+{
+    Results* res = ResultsMgr.CreateResults( "Update_Stats" );
+
+    res->Add( NameValData( "Num_Surf_Updates", m_NumSurfUpdates ) );
+    res->Add( NameValData( "Num_XForm_Updates", m_NumXFormUpdates ) );
+    res->Add( NameValData( "Num_Skipped_Updates", m_NumSkippedUpdates ) );
+    res->Add( NameValData( "Update_Time", m_UpdateTime ) );
+
+    return res->GetID();
 }
 
 void Vehicle::UpdateGeom( const string &geom_id )
@@ -523,6 +749,61 @@ vector< Geom* > Vehicle::FindGeomVec( const vector< string > & geom_id_vec )
 
 //=== Create Geom of Type, Add To Storage and Return ID ====//
 string Vehicle::CreateGeom( const GeomType & type )
+{
+    Geom* new_geom = NewGeom( type );
+
+    if ( !new_geom )
+    {
+        printf( "Error: Could not create Geom of type: %s\n", type.m_Name.c_str() );
+        return "NONE";
+    }
+
+    m_GeomStoreVec.push_back( new_geom );
+
+    Geom* type_geom_ptr = FindGeom( type.m_GeomID );
+    if ( type_geom_ptr )
+    {
+        string id = new_geom->GetID();
+        new_geom->CopyFrom( type_geom_ptr );
+        new_geom->SetName( type.m_Name );
+    }
+
+    return new_geom->GetID();
+}
+
+//=== Copy A Geom Outside The Vehicle Store ====//
+// The copy keeps its parent ID so it attaches the same way, but is not in the
+// parent's child list, has no children and is never found by FindGeom.  Custom
+// Geoms need their script module and are not copied.  The caller deletes the copy.
+Geom* Vehicle::CloneGeom( Geom* geom_ptr )
+{
+    if ( !geom_ptr || geom_ptr->GetType().m_Type == CUSTOM_GEOM_TYPE )
+    {
+        return NULL;
+    }
+
+    Geom* new_geom = NewGeom( geom_ptr->GetType() );
+    if ( !new_geom )
+    {
+        return NULL;
+    }
+
+    string lastreset = ParmMgr.ResetRemapID();
+    new_geom->CopyFrom( geom_ptr );
+    ParmMgr.ResetRemapID( lastreset );
+
+    // The parent already exists, so decoding remapped its ID to a new one
+    new_geom->SetParentID( geom_ptr->GetParentID() );
+
+    vector< string > no_child_vec;
+    new_geom->SetChildIDVec( no_child_vec );
+    new_geom->SetLateUpdateFlag( true );
+
+    return new_geom;
+}
+
+//=== Construct Geom of Type ====//
+Geom* Vehicle::NewGeom( const GeomType & type )
 {
     Geom* new_geom = NULL;
 
@@ -583,23 +864,7 @@ string Vehicle::CreateGeom( const GeomType & type )
         new_geom = new WireGeom( this );
     }
 
-    if ( !new_geom )
-    {
-        printf( "Error: Could not create Geom of type: %s\n", type.m_Name.c_str() );
-        return "NONE";
-    }
-
-    m_GeomStoreVec.push_back( new_geom );
-
-    Geom* type_geom_ptr = FindGeom( type.m_GeomID );
-    if ( type_geom_ptr )
-    {
-        string id = new_geom->GetID();
-        new_geom->CopyFrom( type_geom_ptr );
-        new_geom->SetName( type.m_Name );
-    }
-
-    return new_geom->GetID();
+    return new_geom;
 }
 
 //=== Create Geom and Set Up Parent/Child ====//
@@ -3738,6 +4003,10 @@ string Vehicle::getExportFileName( int type )
     {
         doreturn = true;
     }
+    else if ( type == DEGEN_GEOM_BIN_TYPE )
+    {
+        doreturn = true;
+    }
     else if ( type == PROJ_AREA_CSV_TYPE )
     {
         doreturn = true;
@@ -3802,6 +4071,10 @@ void Vehicle::setExportFileName( int type, string f_name )
     {
         doset = true;
     }
+    else if ( type == DEGEN_GEOM_BIN_TYPE )
+    {
+        doset = true;
+    }
     else if ( type == PROJ_AREA_CSV_TYPE )
     {
         doset = true;
@@ -3827,8 +4100,8 @@ void Vehicle::setExportFileName( int type, string f_name )
 
 void Vehicle::resetExportFileNames()
 {
-    const char *suffix[] = {"_CompGeom.txt", "_CompGeom.csv", "_DragBuild.tsv", "_AwaveSlice.txt", "_MassProps.txt", "_DegenGeom.csv", "_DegenGeom.m", "_ProjArea.csv", "_WaveDrag.txt", ".tri", "_ParasiteBuildUp.csv" };
-    const int types[] = { COMP_GEOM_TXT_TYPE, COMP_GEOM_CSV_TYPE, DRAG_BUILD_TSV_TYPE, SLICE_TXT_TYPE, MASS_PROP_TXT_TYPE, DEGEN_GEOM_CSV_TYPE, DEGEN_GEOM_M_TYPE, PROJ_AREA_CSV_TYPE, WAVE_DRAG_TXT_TYPE, VSPAERO_PANEL_TRI_TYPE, DRAG_BUILD_CSV_TYPE };
+    const char *suffix[] = {"_CompGeom.txt", "_CompGeom.csv", "_DragBuild.tsv", "_AwaveSlice.txt", "_MassProps.txt", "_DegenGeom.csv", "_DegenGeom.m", "_ProjArea.csv", "_WaveDrag.txt", ".tri", "_ParasiteBuildUp.csv", "_DegenGeom.bin" };
+    const int types[] = { COMP_GEOM_TXT_TYPE, COMP_GEOM_CSV_TYPE, DRAG_BUILD_TSV_TYPE, SLICE_TXT_TYPE, MASS_PROP_TXT_TYPE, DEGEN_GEOM_CSV_TYPE, DEGEN_GEOM_M_TYPE, PROJ_AREA_CSV_TYPE, WAVE_DRAG_TXT_TYPE, VSPAERO_PANEL_TRI_TYPE, DRAG_BUILD_CSV_TYPE, DEGEN_GEOM_BIN_TYPE };
     const int ntype = ( sizeof(types) / sizeof(types[0]) );
     int pos;
 
@@ -3896,6 +4169,59 @@ string Vehicle::CompGeomAndFlatten( int set, int halfFlag, int intSubsFlag )
     return id;
 }
 
+//==== Comp_Geom Results, Reused While The Set Is Unchanged ====//
+Results* Vehicle::CompGeomResults( int set, int halfFlag, int intSubsFlag )
+{
+    unsigned long long hash = GetSetStateHash( set );
+    hash = HashInt( halfFlag, hash );
+    hash = HashInt( intSubsFlag, hash );
+
+    if ( hash == m_CompGeomHash )
+    {
+        Results* res = ResultsMgr.CreateResults( "Comp_Geom" );
+        vector< string > name_vec = m_CompGeomCache.GetAllDataNames();
+        for ( int i = 0 ; i < ( int )name_vec.size() ; i++ )
+        {
+            int ndata = m_CompGeomCache.GetNumData( name_vec[i] );
+            for ( int j = 0 ; j < ndata ; j++ )
+            {
+                res->Add( m_CompGeomCache.Find( name_vec[i], j ) );
+            }
+        }
+        return res;
+    }
+
+    m_CompGeomHash = 0;
+    m_CompGeomCache = NameValCollection();
+
+    string id = CompGeomAndFlatten( set, halfFlag, intSubsFlag );
+    if ( id.compare( "NONE" ) == 0 )
+    {
+        return NULL;
+    }
+    DeleteGeom( id );
+
+    Results* res = ResultsMgr.FindResultsPtr( ResultsMgr.FindLatestResultsID( "Comp_Geom" ) );
+    if ( !res )
+    {
+        return NULL;
+    }
+
+    m_CompGeomCache = NameValCollection( res->GetName(), res->GetID() );
+    vector< string > name_vec = res->GetAllDataNames();
+    for ( int i = 0 ; i < ( int )name_vec.size() ; i++ )
+    {
+        int ndata = res->GetNumData( name_vec[i] );
+        for ( int j = 0 ; j < ndata ; j++ )
+        {
+            m_CompGeomCache.Add( res->Find( name_vec[i], j ) );
+        }
+    }
+    m_CompGeomHash = hash;
+
+    return res;
+}
+
 string Vehicle::MassProps( int set, int numSlices, bool hidegeom, bool writefile )
 {
     string id = AddMeshGeom( set );
@@ -4463,63 +4789,180 @@ void Vehicle::ExportFile( const string & file_name, int write_set, int file_type
     }
 }
 
+//==== Hash The State Of Every Geom In A Set ====//
+unsigned long long Vehicle::GetSetStateHash( int set )
+{
+    unsigned long long hash = HashInt( set );
+
+    vector< Geom* > geom_vec = FindGeomVec( GetGeomVec( false ) );
+    for ( int i = 0 ; i < ( int )geom_vec.size() ; i++ )
+    {
+        if ( geom_vec[i]->GetSetFlag( set ) )
+        {
+            unsigned long long geom_hash = geom_vec[i]->GetStateHash();
+            hash = HashBytes( &geom_hash, sizeof( geom_hash ), hash );
+        }
+    }
+    return hash;
+}
+
+void Vehicle::ClearGeomResultsCache()
+{
+    m_DegenCompCache.clear();
+    m_DegenSetHash = 0;
+    m_DegenSetCache.clear();
+    m_DegenSetCacheIDVec.clear();
+    m_DegenPtMassCache.clear();
+
+    m_CompGeomHash = 0;
+    m_CompGeomCache = NameValCollection();
+}
+
 void Vehicle::CreateDegenGeom( int set )
 {
-    vector< string > geom_id_vec;
     m_DegenGeomVec.clear();
     m_DegenPtMassVec.clear();
 
+    //==== Hash Each Component, Folded The Same Way As GetSetStateHash ====//
+    vector< Geom* > set_geom_vec;
+    vector< unsigned long long > geom_hash_vec;
+    unsigned long long set_hash = HashInt( set );
+
     vector< Geom* > geom_vec = FindGeomVec( GetGeomVec( false ) );
     for ( int i = 0 ; i < ( int )geom_vec.size() ; i++ )
     {
         if ( geom_vec[i]->GetSetFlag( set ) )
         {
-            if( geom_vec[i]->GetType().m_Type == BLANK_GEOM_TYPE )
+            unsigned long long geom_hash = geom_vec[i]->GetStateHash();
+            set_hash = HashBytes( &geom_hash, sizeof( geom_hash ), set_hash );
+            set_geom_vec.push_back( geom_vec[i] );
+            geom_hash_vec.push_back( geom_hash );
+        }
+    }
+
+    //==== Nothing In The Set Changed - Reuse The Trimmed Results ====//
+    if ( set_hash == m_DegenSetHash )
+    {
+        m_DegenGeomVec = m_DegenSetCache;
+        for ( int i = 0 ; i < ( int )m_DegenGeomVec.size() ; i++ )
+        {
+            // Geoms restored by undo keep their ID but not their address
+            m_DegenGeomVec[i].setParentGeom( FindGeom( m_DegenSetCacheIDVec[i] ) );
+        }
+        m_DegenPtMassVec = m_DegenPtMassCache;
+        m_DegenMeshTime = 0;
+        m_DegenPeakMemGrowth = 0;
+        return;
+    }
+
+    //==== Only Rebuild Components Whose Hash Changed ====//
+    map< string, pair< unsigned long long, vector< DegenGeom > > > comp_cache;
+    vector< string > owner_id_vec;
+
+    for ( int i = 0 ; i < ( int )set_geom_vec.size() ; i++ )
+    {
+        Geom* geom = set_geom_vec[i];
+        string geom_id = geom->GetID();
+
+        if( geom->GetType().m_Type == BLANK_GEOM_TYPE )
+        {
+            BlankGeom *g = (BlankGeom*) geom;
+            if( g->m_PointMassFlag() )
             {
-                BlankGeom *g = (BlankGeom*) geom_vec[i];
-                if( g->m_PointMassFlag() )
-                {
-                    DegenPtMass pm;
-                    pm.name = g->GetName();
-                    pm.mass = g->m_PointMass();
-                    pm.x = g->m_BlankOrigin;
-                    pm.geom_id = g->GetID();
-                    m_DegenPtMassVec.push_back( pm );
-                }
+                DegenPtMass pm;
+                pm.name = g->GetName();
+                pm.mass = g->m_PointMass();
+                pm.x = g->m_BlankOrigin;
+                pm.geom_id = geom_id;
+                m_DegenPtMassVec.push_back( pm );
+            }
+        }
+        else
+        {
+            map< string, pair< unsigned long long, vector< DegenGeom > > >::iterator iter = m_DegenCompCache.find( geom_id );
+            if ( iter != m_DegenCompCache.end() && iter->second.first == geom_hash_vec[i] )
+            {
+                comp_cache[ geom_id ] = iter->second;
             }
             else
             {
-                geom_vec[i]->CreateDegenGeom( m_DegenGeomVec );
+                vector< DegenGeom > dgs;
+                geom->CreateDegenGeom( dgs );
+                comp_cache[ geom_id ] = make_pair( geom_hash_vec[i], dgs );
+            }
+
+            vector< DegenGeom > & dgs = comp_cache[ geom_id ].second;
+            for ( int j = 0 ; j < ( int )dgs.size() ; j++ )
+            {
+                m_DegenGeomVec.push_back( dgs[j] );
+                m_DegenGeomVec.back().setParentGeom( geom );
+                owner_id_vec.push_back( geom_id );
             }
         }
     }
 
+    // Keep only the components of this set so the cache stays bounded
+    m_DegenCompCache.swap( comp_cache );
+
     vector< string > active_vec_store = GetActiveGeomVec();
 
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    size_t start_mem = GetPeakMemoryUsage();
+
+    //==== One Trimmed Mesh Feeds Both Area and Mass Slicing ====//
+    // Intersection couples every component in the set, so it always reruns
     string id = AddMeshGeom( set );
     if ( id.compare( "NONE" ) != 0 )
     {
         MeshGeom* mesh_ptr = dynamic_cast<MeshGeom*> ( FindGeom( id ) );
         if ( mesh_ptr != NULL )
         {
-            mesh_ptr->degenGeomIntersectTrim(m_DegenGeomVec);
+            mesh_ptr->degenGeomIntersectTrim( m_DegenGeomVec );
+            mesh_ptr->degenGeomMassSliceX( m_DegenGeomVec, false );
             DeleteGeom( id );
         }
     }
 
+    size_t peak_mem = GetPeakMemoryUsage();
+    m_DegenMeshTime = std::chrono::duration< double >( std::chrono::steady_clock::now() - start ).count();
+    m_DegenPeakMem = peak_mem / ( 1024.0 * 1024.0 );
+    m_DegenPeakMemGrowth = ( peak_mem - start_mem ) / ( 1024.0 * 1024.0 );
 
-    id = AddMeshGeom( set );
-    if ( id.compare( "NONE" ) != 0 )
+    SetActiveGeomVec( active_vec_store );
+
+    m_DegenSetHash = set_hash;
+    m_DegenSetCache = m_DegenGeomVec;
+    m_DegenSetCacheIDVec = owner_id_vec;
+    m_DegenPtMassCache = m_DegenPtMassVec;
+}
+
+//==== Write Degen Geom CSV Data To An Open File ====//
+void Vehicle::WriteDegenGeomCsvFile( FILE* file_id )
+{
+    fprintf(file_id, "# DEGENERATE GEOMETRY CSV FILE\n\n");
+    fprintf(file_id, "# NUMBER OF COMPONENTS\n%d\n", (int)m_DegenGeomVec.size());
+
+    if ( m_DegenPtMassVec.size() > 0 )
     {
-        MeshGeom* mesh_ptr = dynamic_cast<MeshGeom*> ( FindGeom( id ) );
-        if ( mesh_ptr != NULL )
+        fprintf(file_id, "BLANK_GEOMS,%d\n", (int)m_DegenPtMassVec.size());
+        fprintf(file_id, "# Name, xLoc, yLoc, zLoc, Mass, GeomID");
+
+        for ( int i = 0; i < (int)m_DegenPtMassVec.size(); i++ )
         {
-            mesh_ptr->degenGeomMassSliceX(m_DegenGeomVec);
-            DeleteGeom( id );
+            // Blank geom translated location
+            fprintf(file_id, "\n%s,%f,%f,%f,%f,%s", m_DegenPtMassVec[i].name.c_str(), \
+                                                 m_DegenPtMassVec[i].x.v[0], \
+                                                 m_DegenPtMassVec[i].x.v[1], \
+                                                 m_DegenPtMassVec[i].x.v[2], \
+                                                 m_DegenPtMassVec[i].mass, \
+                                                 m_DegenPtMassVec[i].geom_id.c_str() );
         }
     }
 
-    SetActiveGeomVec( active_vec_store );
+    for ( int i = 0; i < (int)m_DegenGeomVec.size(); i++ )
+    {
+        m_DegenGeomVec[i].write_degenGeomCsv_file( file_id );
+    }
 }
 
 //==== Write Degen Geom File ====//
@@ -4540,8 +4983,13 @@ string Vehicle::WriteDegenGeomFile()
     outStr += geomCntStr;
     outStr += " blank geoms\nto the following files:\n\n";
 
+    double csv_time = 0, csv_size = 0;
+    double bin_time = 0, bin_size = 0;
+
     if ( getExportDegenGeomCsvFile() )
     {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
         string file_name = getExportFileName( DEGEN_GEOM_CSV_TYPE );
         FILE* file_id = fopen(file_name.c_str(), "w");
 
@@ -4553,32 +5001,11 @@ string Vehicle::WriteDegenGeomFile()
         }
         else
         {
-            fprintf(file_id, "# DEGENERATE GEOMETRY CSV FILE\n\n");
-            fprintf(file_id, "# NUMBER OF COMPONENTS\n%d\n", geomCnt);
-
-            if ( m_DegenPtMassVec.size() > 0 )
-            {
-                fprintf(file_id, "BLANK_GEOMS,%d\n", blankCnt);
-                fprintf(file_id, "# Name, xLoc, yLoc, zLoc, Mass, GeomID");
-
-                for ( int i = 0; i < (int)m_DegenPtMassVec.size(); i++ )
-                {
-                    // Blank geom translated location
-                    fprintf(file_id, "\n%s,%f,%f,%f,%f,%s", m_DegenPtMassVec[i].name.c_str(), \
-                                                         m_DegenPtMassVec[i].x.v[0], \
-                                                         m_DegenPtMassVec[i].x.v[1], \
-                                                         m_DegenPtMassVec[i].x.v[2], \
-                                                         m_DegenPtMassVec[i].mass, \
-                                                         m_DegenPtMassVec[i].geom_id.c_str() );
-                }
-            }
-
-            for ( int i = 0; i < (int)m_DegenGeomVec.size(); i++ )
-            {
-                m_DegenGeomVec[i].write_degenGeomCsv_file( file_id );
-            }
+            WriteDegenGeomCsvFile( file_id );
 
+            csv_size = ftell( file_id ) / ( 1024.0 * 1024.0 );
             fclose(file_id);
+            csv_time = std::chrono::duration< double >( std::chrono::steady_clock::now() - start ).count();
 
             outStr += "\t";
             outStr += file_name;
@@ -4635,6 +5062,64 @@ string Vehicle::WriteDegenGeomFile()
         }
     }
 
+    if ( getExportDegenGeomBinFile() )
+    {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+        string file_name = getExportFileName( DEGEN_GEOM_BIN_TYPE );
+        DegenBinWriter writer;
+        if ( !writer.Open( file_name ) )
+        {
+            outStr += "\tFAILED TO OPEN: ";
+            outStr += file_name;
+            outStr += "\n";
+        }
+        else
+        {
+            if ( blankCnt > 0 )
+            {
+                writer.BeginChunk( "BLANK_GEOMS" );
+                for ( int i = 0; i < ( int )m_DegenPtMassVec.size(); i++ )
+                {
+                    string idx = std::to_string( ( long long ) i );
+                    writer.AddAttr( "name" + idx, m_DegenPtMassVec[i].name );
+                    writer.AddAttr( "geom_id" + idx, m_DegenPtMassVec[i].geom_id );
+                }
+
+                vector< uint64_t > dims;
+                dims.push_back( blankCnt );
+                dims.push_back( 4 );
+                writer.BeginArray( "BLANK_GEOMS", "x,y,z,mass", dims );
+                for ( int i = 0; i < ( int )m_DegenPtMassVec.size(); i++ )
+                {
+                    double row[4] = { m_DegenPtMassVec[i].x.x(), m_DegenPtMassVec[i].x.y(), m_DegenPtMassVec[i].x.z(), m_DegenPtMassVec[i].mass };
+                    writer.WriteRow( row, 4 );
+                }
+                writer.EndArray();
+                writer.EndChunk();
+            }
+
+            for ( int i = 0; i < ( int )m_DegenGeomVec.size(); i++ )
+            {
+                m_DegenGeomVec[i].write_degenGeomBin_file( writer );
+            }
+
+            if ( !writer.Close() )
+            {
+                outStr += "\tFAILED TO WRITE: ";
+            }
+            else
+            {
+                outStr += "\t";
+            }
+            bin_size = writer.GetFileBytes() / ( 1024.0 * 1024.0 );
+            bin_time = std::chrono::duration< double >( std::chrono::steady_clock::now() - start ).count();
+
+            outStr += file_name;
+            outStr += "\n";
+        }
+    }
+
     // Create results object to contain the ids of all of the results associated
     // with degen geoms
     Results *res = ResultsMgr.CreateResults( "DegenGeom" );
@@ -4662,6 +5147,13 @@ string Vehicle::WriteDegenGeomFile()
 
     res->Add( NameValData( "Degen_BlankGeoms", blank_degen_result_ids ) );
     res->Add( NameValData( "Degen_DegenGeoms", degen_results_ids ) );
+    res->Add( NameValData( "Mesh_Time", m_DegenMeshTime ) );
+    res->Add( NameValData( "Peak_Memory_MB", m_DegenPeakMem ) );
+    res->Add( NameValData( "Peak_Memory_Growth_MB", m_DegenPeakMemGrowth ) );
+    res->Add( NameValData( "CSV_Write_Time", csv_time ) );
+    res->Add( NameValData( "CSV_Size_MB", csv_size ) );
+    res->Add( NameValData( "Bin_Write_Time", bin_time ) );
+    res->Add( NameValData( "Bin_Size_MB", bin_size ) );
     return outStr;
 }
 
@@ -4729,8 +5221,26 @@ double Vehicle::ProjPnt01I(const std::string &geom_id, const vec3d & pt, int &su
     if ( geom )
     {
         int nsurf = geom->GetNumTotalSurfs();
+
+        //==== Visit Surfaces Nearest Bounding Box First ====//
+        vector< pair< double, int > > box_order( nsurf );
         for ( int i = 0; i < nsurf; i++ )
         {
+            BndBox box;
+            geom->GetSurfPtr(i)->GetBoundingBox( box );
+            box_order[i] = make_pair( BoxDist( box, pt ), i );
+        }
+        std::sort( box_order.begin(), box_order.end() );
+
+        for ( int k = 0; k < nsurf; k++ )
+        {
+            // Every remaining surface is farther away than the best point found
+            if ( box_order[k].first >= dmin )
+            {
+                break;
+            }
+
+            int i = box_order[k].second;
             double utest, wtest;
 
             double d = geom->GetSurfPtr(i)->FindNearest01( utest, wtest, pt );
@@ -4752,6 +5262,23 @@ double Vehicle::ProjPnt01I(const std::string &geom_id, const vec3d & pt, int &su
     return dmin;
 }
 
+void Vehicle::ProjVecPnt01I(const std::string &geom_id, const vector < vec3d > & pts, vector < int > &surf_indx_vec, vector < double > &u_vec, vector < double > &w_vec, vector < double > &d_vec )
+{
+    Geom * geom = FindGeom( geom_id );
+
+    if ( geom )
+    {
+        int nsurf = geom->GetNumTotalSurfs();
+        vector < const VspSurf* > surf_vec( nsurf );
+        for ( int i = 0; i < nsurf; i++ )
+        {
+            surf_vec[i] = geom->GetSurfPtr( i );
+        }
+
+        ProjectVecPnt01( surf_vec, pts, surf_indx_vec, u_vec, w_vec, d_vec );
+    }
+}
+
 // Method to add pnts and normals to results managers for all surfaces
 // in the selected set
 string Vehicle::ExportSurfacePatches( int set )
@@ -33,8 +33,11 @@
 #include <string>
 #include <vector>
 #include <deque>
+#include <map>
 #include <stack>
 #include <memory>
+#include <mutex>
+#include <set>
 
 
 #define MIN_FILE_VER 4 // Lowest file version number for 3.X vsp file
@@ -73,6 +76,20 @@ public:
     void Update( bool fullupdate = true );
     void UpdateGeom( const string &geom_id );
     void ForceUpdate();
+
+    //==== Update Counts And Timing ====//
+    void CountGeomUpdate( bool surf_flag );
+    void CountGeomSkip();
+    void ResetUpdateStats();
+    string CreateUpdateStatsResults();
+    int GetNumSurfUpdates()                                          { return m_NumSurfUpdates; }
+    int GetNumXFormUpdates()                                         { return m_NumXFormUpdates; }
+    int GetNumSkippedUpdates()                                       { return m_NumSkippedUpdates; }
+    double GetUpdateTime()                                           { return m_UpdateTime; }
+
+    //==== Threads For Updating Independent Geom Trees ( <= 0 One Per Core ) ====//
+    void SetUpdateThreads( int num_threads )                         { m_UpdateThreads = num_threads; }
+    int GetUpdateThreads()                                           { return m_UpdateThreads; }
     void UpdateGui();
     void RunScript( const string & file_name, const string & function_name = "void main()" );
 
@@ -80,6 +97,7 @@ public:
     vector< Geom* > FindGeomVec( const vector< string > & geom_id_vec );
 
     string CreateGeom( const GeomType & type );
+    Geom* CloneGeom( Geom* geom_ptr );
     string AddGeom( const GeomType & type );
     string AddGeom( Geom* add_geom );
     string AddMeshGeom( int set );
@@ -231,8 +249,10 @@ public:
 
     bool getExportDegenGeomCsvFile( )                  { return m_exportDegenGeomCsvFile(); }
     bool getExportDegenGeomMFile( )                    { return m_exportDegenGeomMFile(); }
+    bool getExportDegenGeomBinFile( )                  { return m_exportDegenGeomBinFile(); }
     void setExportDegenGeomCsvFile( bool b )           { m_exportDegenGeomCsvFile.Set( b ); }
     void setExportDegenGeomMFile( bool b )             { m_exportDegenGeomMFile.Set( b ); }
+    void setExportDegenGeomBinFile( bool b )           { m_exportDegenGeomBinFile.Set( b ); }
 
     //==== Import Files ====//
     string ImportFile( const string & file_name, int file_type );
@@ -242,6 +262,7 @@ public:
     //Comp Geom
     string CompGeom( int set, int halfFlag, int intSubsFlag = 1 );
     string CompGeomAndFlatten( int set, int halfFlag, int intSubsFlag = 1 );
+    Results* CompGeomResults( int set, int halfFlag, int intSubsFlag = 1 );
     string MassProps( int set, int numSlices, bool hidegeom = true, bool writefile = true );
     string MassPropsAndFlatten( int set, int numSlices, bool hidegeom = true, bool writefile = true );
     string PSlice( int set, int numSlices, vec3d norm, bool autoBoundsFlag, double start = 0, double end = 0 );
@@ -250,14 +271,21 @@ public:
     //==== Degenerate Geometry ====//
     void CreateDegenGeom( int set );
     vector< DegenGeom > GetDegenGeomVec()    { return m_DegenGeomVec; }
+    double GetDegenMeshTime()               { return m_DegenMeshTime; }     // 0 when the cached set was reused
     string WriteDegenGeomFile();
+    void WriteDegenGeomCsvFile( FILE* file_id );
     void ClearDegenGeom()   { m_DegenGeomVec.clear(); }
 
+    //==== Cached Geometry Results, Keyed By Geom State Hash ====//
+    unsigned long long GetSetStateHash( int set );
+    void ClearGeomResultsCache();
+
     //==== Surface Query ====//
     vec3d CompPnt01(const std::string &geom_id, const int &surf_indx, const double &u, const double &w);
     vec3d CompNorm01(const std::string &geom_id, const int &surf_indx, const double &u, const double &w);
     void CompCurvature01(const std::string &geom_id, const int &surf_indx, const double &u, const double &w, double &k1, double &k2, double &ka, double &kg);
     double ProjPnt01I(const std::string &geom_id, const vec3d & pt, int &surf_indx, double &u, double &w);
+    void ProjVecPnt01I(const std::string &geom_id, const vector < vec3d > & pts, vector < int > &surf_indx_vec, vector < double > &u_vec, vector < double > &w_vec, vector < double > &d_vec );
 
     //=== Surface API ===//
     string ExportSurfacePatches( int set );
@@ -377,6 +405,7 @@ public:
     BoolParm m_exportDragBuildTsvFile;
     BoolParm m_exportDegenGeomCsvFile;
     BoolParm m_exportDegenGeomMFile;
+    BoolParm m_exportDegenGeomBinFile;
 
     Parm m_AxisLength;
     Parm m_TextSize;
@@ -391,6 +420,22 @@ protected:
 
     vector< DegenGeom > m_DegenGeomVec;         // Vector of components in degenerate representation
     vector< DegenPtMass > m_DegenPtMassVec;
+    double m_DegenMeshTime;                     // Seconds spent meshing, trimming and slicing
+    double m_DegenPeakMem;                      // Process peak memory after meshing (MB)
+    double m_DegenPeakMemGrowth;                // Rise in process peak memory during meshing (MB)
+
+    // Untrimmed DegenGeom of each component in the last set, by Geom ID, with its state hash
+    map< string, pair< unsigned long long, vector< DegenGeom > > > m_DegenCompCache;
+
+    // Trimmed DegenGeom of the last set, with the owning Geom ID of each entry
+    unsigned long long m_DegenSetHash;
+    vector< DegenGeom > m_DegenSetCache;
+    vector< string > m_DegenSetCacheIDVec;
+    vector< DegenPtMass > m_DegenPtMassCache;
+
+    // Comp_Geom results of the last CompGeomResults call
+    unsigned long long m_CompGeomHash;
+    NameValCollection m_CompGeomCache;
 
     vector < vector < vector < vec3d > > > m_VehProjectVec3d; // Vector of projection lines for each view direction (x, y, or z)
 
@@ -405,6 +450,22 @@ protected:
     bool m_UpdatingBBox;
     BndBox m_BBox;                              // Bounding Box Around All Geometries
 
+    Geom* NewGeom( const GeomType & type );
+
+    void UpdateDirty( Geom* geom_ptr, bool fullupdate );
+    bool IsTreeDirty( Geom* geom_ptr, bool fullupdate );
+    bool IsTreeThreadSafe( Geom* geom_ptr );
+    Geom* FindTopGeom( Geom* geom_ptr );
+    void FindLinkedTopGeoms( std::set< string > & top_id_set );
+
+    int m_UpdateThreads;
+    std::mutex m_UpdateStatsMutex;
+
+    int m_NumSurfUpdates;                       // Geom updates that rebuilt the surfaces
+    int m_NumXFormUpdates;                      // Geom updates that only moved the surfaces
+    int m_NumSkippedUpdates;                    // Geoms left alone by Update
+    double m_UpdateTime;                        // Seconds spent in Update
+
     void SetApplyAbsIgnoreFlag( const vector< string > &g_vec, bool val );
 
     //==== Primary file name ====//
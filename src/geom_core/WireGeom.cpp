@@ -738,6 +738,25 @@ bool WireGeom::CheckInverted()
     return false;
 }
 
+//==== Wire Points Are Read From File, Not Parms ====//
+unsigned long long WireGeom::GetStateHash()
+{
+    unsigned long long hash = Geom::GetStateHash();
+
+    for ( int i = 0 ; i < ( int )m_WirePts.size() ; i++ )
+    {
+        hash = HashInt( ( int )m_WirePts[i].size(), hash );
+        for ( int j = 0 ; j < ( int )m_WirePts[i].size() ; j++ )
+        {
+            hash = HashDouble( m_WirePts[i][j].x(), hash );
+            hash = HashDouble( m_WirePts[i][j].y(), hash );
+            hash = HashDouble( m_WirePts[i][j].z(), hash );
+        }
+    }
+
+    return hash;
+}
+
 //==== Create TMesh Vector ====//
 vector< TMesh* > WireGeom::CreateTMeshVec()
 {
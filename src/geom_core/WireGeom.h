@@ -36,6 +36,7 @@ public:
     virtual xmlNodePtr DecodeXml( xmlNodePtr & node );
 
     virtual vector< TMesh* > CreateTMeshVec();
+    virtual unsigned long long GetStateHash();
 
     virtual void CreateDegenGeom( vector<DegenGeom> &dgs, bool preview = false );
 
@@ -249,6 +249,9 @@ string XSecSurf::InsertXSec( int type, int index )
             m_XSecIDDeque.push_back( xs->GetID() );
         }
     }
+
+    MarkParentGeomDirty( m_ParentContainer, GeomBase::UPDATE_SURF );
+
     return id;
 }
 
@@ -263,6 +266,9 @@ string XSecSurf::AddXSec( int type )
         id = xs->GetID();
         m_XSecIDDeque.push_back( id );
     }
+
+    MarkParentGeomDirty( m_ParentContainer, GeomBase::UPDATE_SURF );
+
     return id;
 }
 
@@ -290,6 +296,8 @@ void XSecSurf::CutXSec( int index )
 
     m_SavedXSec = xs->GetID();
     m_XSecIDDeque.erase( m_XSecIDDeque.begin() + index );
+
+    MarkParentGeomDirty( m_ParentContainer, GeomBase::UPDATE_SURF );
 }
 
 //==== Copy XSec ====//
@@ -358,6 +366,8 @@ void XSecSurf::PasteXSec( int index )
     vector_remove_val( m_XSecPtrVec, xs );
 
     delete xs;
+
+    MarkParentGeomDirty( m_ParentContainer, GeomBase::UPDATE_SURF );
 }
 
 //==== Copy XSec Curve====//
@@ -404,7 +414,7 @@ void XSecSurf::PasteXSecCurve( int index )
 
     xs->SetXSecCurve( duplicate_saved_crv );
 
-
+    MarkParentGeomDirty( m_ParentContainer, GeomBase::UPDATE_SURF );
 }
 
 //==== Change XSec Type ====//
@@ -433,6 +443,8 @@ void XSecSurf::ChangeXSecShape( int index, int type )
         vector_remove_val( m_XSecPtrVec, xs );
         delete xs;
     }
+
+    MarkParentGeomDirty( m_ParentContainer, GeomBase::UPDATE_SURF );
 }
 
 void XSecSurf::GetBasicTransformation( double w, Matrix4d &mat )
@@ -8,7 +8,7 @@
 #include "DegenGeomScreen.h"
 #include "CfdMeshMgr.h"
 
-DegenGeomScreen::DegenGeomScreen( ScreenMgr* mgr ) : BasicScreen( mgr, 375, 365, "Degen Geom - Compute Models, File IO" )
+DegenGeomScreen::DegenGeomScreen( ScreenMgr* mgr ) : BasicScreen( mgr, 375, 390, "Degen Geom - Compute Models, File IO" )
 {
     m_FLTK_Window->callback( staticCloseCB, this );
     m_MainLayout.SetGroupAndScreen( m_FLTK_Window, this );
@@ -41,6 +41,12 @@ DegenGeomScreen::DegenGeomScreen( ScreenMgr* mgr ) : BasicScreen( mgr, 375, 365,
     m_BorderLayout.ForceNewLine();
     m_BorderLayout.AddYGap();
 
+    m_BorderLayout.AddButton(m_BinToggle, ".bin");
+    m_BorderLayout.AddOutput(m_BinOutput);
+    m_BorderLayout.AddButton(m_BinSelect, "...");
+    m_BorderLayout.ForceNewLine();
+    m_BorderLayout.AddYGap();
+
     m_BorderLayout.SetFitWidthFlag( true );
     m_BorderLayout.SetSameLineFlag( false );
 
@@ -118,12 +124,15 @@ bool DegenGeomScreen::Update()
     //===== Update File Toggle Buttons =====//
     m_CsvToggle.Update( vehiclePtr->m_exportDegenGeomCsvFile.GetID() );
     m_MToggle.Update( vehiclePtr->m_exportDegenGeomMFile.GetID() );
+    m_BinToggle.Update( vehiclePtr->m_exportDegenGeomBinFile.GetID() );
 
     //===== Update File Output Text =====//
     string csvName = vehiclePtr->getExportFileName( vsp::DEGEN_GEOM_CSV_TYPE );
     string mName = vehiclePtr->getExportFileName( vsp::DEGEN_GEOM_M_TYPE );
     m_CsvOutput.Update( truncateFileName( csvName, 40 ).c_str() );
+    string binName = vehiclePtr->getExportFileName( vsp::DEGEN_GEOM_BIN_TYPE );
     m_MOutput.Update( truncateFileName( mName, 40 ).c_str() );
+    m_BinOutput.Update( truncateFileName( binName, 40 ).c_str() );
 
     m_FLTK_Window->redraw();
     return false;
@@ -161,6 +170,12 @@ void DegenGeomScreen::GuiDeviceCallBack( GuiDevice* device )
                                        m_ScreenMgr->GetSelectFileScreen()->FileChooser(
                                                "Select degen geom Matlab output file.", "*.m" ) );
     }
+    else if ( device == &m_BinSelect )
+    {
+        vehiclePtr->setExportFileName( vsp::DEGEN_GEOM_BIN_TYPE,
+                                       m_ScreenMgr->GetSelectFileScreen()->FileChooser(
+                                               "Select degen geom binary output file.", "*.bin" ) );
+    }
     else if ( device == &m_UseSet )
     {
         m_SelectedSetIndex = m_UseSet.GetVal();
@@ -45,12 +45,15 @@ protected:
 
     ToggleButton m_CsvToggle;
     ToggleButton m_MToggle;
+    ToggleButton m_BinToggle;
 
     StringOutput m_CsvOutput;
     StringOutput m_MOutput;
+    StringOutput m_BinOutput;
 
     TriggerButton m_CsvSelect;
     TriggerButton m_MSelect;
+    TriggerButton m_BinSelect;
 
     Fl_Text_Display* m_TextDisplay;
     Fl_Text_Buffer* m_TextBuffer;
@@ -0,0 +1,113 @@
+"""Zero-copy reader for binary DegenGeom files (DEGEN_GEOM_BIN_TYPE).
+
+The file is memory mapped and every array is a read-only numpy view into the
+mapping, so nothing is parsed or copied until it is used.  See
+src/util/DegenBinFile.h for the layout.
+
+    import degen_bin
+    for comp in degen_bin.read("model_DegenGeom.bin"):
+        xyz = comp.arrays["SURFACE_NODE"][:, :, 0:3]
+"""
+import mmap
+import struct
+from collections import OrderedDict
+
+import numpy as np
+
+MAGIC = b"VSPDEGEN"
+VERSION = 1
+BOM = 0x01020304
+
+ATTR_RECORD = 1
+ARRAY_RECORD = 2
+
+
+def _pad8(n):
+    return (n + 7) & ~7
+
+
+class DegenBinChunk(object):
+    """One component (or the blank geoms) from a binary DegenGeom file."""
+
+    def __init__(self, kind):
+        self.kind = kind
+        self.attrs = OrderedDict()
+        self.arrays = OrderedDict()
+        self.labels = OrderedDict()
+
+    def column(self, array_name, label):
+        """View of one labelled column, e.g. column("SURFACE_NODE", "x")."""
+        return self.arrays[array_name][..., self.labels[array_name].index(label)]
+
+    def __repr__(self):
+        return "DegenBinChunk(%s, %s, arrays=%s)" % (self.kind, self.attrs.get("name", ""), list(self.arrays))
+
+
+class DegenBinFile(object):
+    """Memory mapped binary DegenGeom file.  Keep it open while using the arrays."""
+
+    def __init__(self, file_name):
+        self._file = open(file_name, "rb")
+        self._map = mmap.mmap(self._file.fileno(), 0, access=mmap.ACCESS_READ)
+        self.chunks = self._parse()
+
+    def close(self):
+        self.chunks = []
+        self._map.close()
+        self._file.close()
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *args):
+        self.close()
+
+    def __iter__(self):
+        return iter(self.chunks)
+
+    def _parse(self):
+        buf = self._map
+        if buf[0:8] != MAGIC:
+            raise IOError("Not a binary DegenGeom file")
+
+        version, bom, num_chunks = struct.unpack_from("=IIQ", buf, 8)
+        if version > VERSION or bom != BOM:
+            raise IOError("Unsupported binary DegenGeom version or byte order")
+
+        chunks = []
+        pos = 32
+        for _ in range(num_chunks):
+            kind = buf[pos:pos + 16].split(b"\0", 1)[0].decode()
+            size, num_attrs, num_arrays = struct.unpack_from("=QII", buf, pos + 16)
+            chunk = DegenBinChunk(kind)
+
+            p = pos + 32
+            for _ in range(num_attrs + num_arrays):
+                tag, a, b, _ = struct.unpack_from("=IIII", buf, p)
+                if tag == ATTR_RECORD:
+                    p += 16
+                    key = buf[p:p + a].decode()
+                    chunk.attrs[key] = buf[p + a:p + a + b].decode()
+                    p = _pad8(p + a + b)
+                elif tag == ARRAY_RECORD:
+                    name = buf[p + 16:p + 40].split(b"\0", 1)[0].decode()
+                    dims = struct.unpack_from("=QQQ", buf, p + 40)[:a]
+                    p += 64
+                    chunk.labels[name] = buf[p:p + b].decode().split(",") if b else []
+                    p = _pad8(p + b)
+                    count = int(np.prod(dims)) if dims else 0
+                    data = np.frombuffer(buf, dtype=np.float64, count=count, offset=p)
+                    chunk.arrays[name] = data.reshape(dims)
+                    p += count * 8
+                else:
+                    raise IOError("Corrupt binary DegenGeom chunk")
+
+            chunks.append(chunk)
+            pos += size
+
+        return chunks
+
+
+def read(file_name):
+    """Open a binary DegenGeom file and return its chunks."""
+    return DegenBinFile(file_name).chunks
@@ -29,6 +29,7 @@ namespace std {
 %apply ( std::vector<double> &OUTPUT ) { std::vector < double > &u_out_vec };
 %apply ( std::vector<double> &OUTPUT ) { std::vector < double > &w_out_vec };
 %apply ( std::vector<double> &OUTPUT ) { std::vector < double > &d_out_vec };
+%apply ( std::vector<int> &OUTPUT ) { std::vector < int > &surf_indx_out_vec };
 
 /* Let's just grab the original header file here */
 %include "APIDefines.h"
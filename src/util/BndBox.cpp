@@ -10,6 +10,8 @@
 
 #include "BndBox.h"
 
+#include <algorithm>
+
 
 //===== Constructor =====//
 BndBox::BndBox()
@@ -335,3 +337,141 @@ std::vector< vec3d > BndBox::GetBBoxDrawLines() const
     return lines;
 }
 
+
+//==== Sweep Axis - Longest Side of Box Around All Boxes ====//
+static int SweepAxis( const std::vector< BndBox > & boxes_a, const std::vector< BndBox > & boxes_b )
+{
+    BndBox all;
+    for ( int i = 0 ; i < ( int )boxes_a.size() ; i++ )
+    {
+        all.Update( boxes_a[i] );
+    }
+    for ( int i = 0 ; i < ( int )boxes_b.size() ; i++ )
+    {
+        all.Update( boxes_b[i] );
+    }
+
+    int axis = 0;
+    for ( int k = 1 ; k < 3 ; k++ )
+    {
+        if ( all.GetMax( k ) - all.GetMin( k ) > all.GetMax( axis ) - all.GetMin( axis ) )
+        {
+            axis = k;
+        }
+    }
+    return axis;
+}
+
+void OverlapPairs( const std::vector< BndBox > & boxes, std::vector< std::pair< int, int > > & pairs, double tol )
+{
+    pairs.clear();
+
+    int nbox = ( int )boxes.size();
+    int axis = SweepAxis( boxes, std::vector< BndBox >() );
+
+    //==== Sort Boxes By Min Along Sweep Axis ====//
+    std::vector< std::pair< double, int > > order( nbox );
+    for ( int i = 0 ; i < nbox ; i++ )
+    {
+        order[i] = std::make_pair( boxes[i].GetMin( axis ), i );
+    }
+    std::sort( order.begin(), order.end() );
+
+    //==== Boxes Leave The Active List Once Sweep Passes Their Max ====//
+    std::vector< int > active;
+    for ( int n = 0 ; n < nbox ; n++ )
+    {
+        int i = order[n].second;
+        double min_i = boxes[i].GetMin( axis );
+
+        int nactive = 0;
+        for ( int a = 0 ; a < ( int )active.size() ; a++ )
+        {
+            int j = active[a];
+            if ( ( min_i - boxes[j].GetMax( axis ) ) > tol )
+            {
+                continue;
+            }
+            active[nactive++] = j;
+
+            if ( Compare( boxes[i], boxes[j], tol ) )
+            {
+                pairs.push_back( std::make_pair( std::min( i, j ), std::max( i, j ) ) );
+            }
+        }
+        active.resize( nactive );
+        active.push_back( i );
+    }
+
+    std::sort( pairs.begin(), pairs.end() );
+}
+
+void OverlapPairs( const std::vector< BndBox > & boxes_a, const std::vector< BndBox > & boxes_b,
+                   std::vector< std::pair< int, int > > & pairs, double tol )
+{
+    pairs.clear();
+
+    int na = ( int )boxes_a.size();
+    int nb = ( int )boxes_b.size();
+    int axis = SweepAxis( boxes_a, boxes_b );
+
+    //==== Sort Both Sets Together, Set b Indices Offset By na ====//
+    std::vector< std::pair< double, int > > order( na + nb );
+    for ( int i = 0 ; i < na ; i++ )
+    {
+        order[i] = std::make_pair( boxes_a[i].GetMin( axis ), i );
+    }
+    for ( int j = 0 ; j < nb ; j++ )
+    {
+        order[na + j] = std::make_pair( boxes_b[j].GetMin( axis ), na + j );
+    }
+    std::sort( order.begin(), order.end() );
+
+    //==== Each New Box Is Tested Against The Active Boxes Of The Other Set ====//
+    std::vector< int > active_a, active_b;
+    for ( int n = 0 ; n < na + nb ; n++ )
+    {
+        int k = order[n].second;
+        bool in_a = k < na;
+        const BndBox & box = in_a ? boxes_a[k] : boxes_b[k - na];
+        double min_k = box.GetMin( axis );
+
+        std::vector< int > & other = in_a ? active_b : active_a;
+        const std::vector< BndBox > & other_boxes = in_a ? boxes_b : boxes_a;
+
+        int nactive = 0;
+        for ( int a = 0 ; a < ( int )other.size() ; a++ )
+        {
+            int j = other[a];
+            if ( ( min_k - other_boxes[j].GetMax( axis ) ) > tol )
+            {
+                continue;
+            }
+            other[nactive++] = j;
+
+            if ( Compare( box, other_boxes[j], tol ) )
+            {
+                if ( in_a )
+                {
+                    pairs.push_back( std::make_pair( k, j ) );
+                }
+                else
+                {
+                    pairs.push_back( std::make_pair( j, k - na ) );
+                }
+            }
+        }
+        other.resize( nactive );
+
+        if ( in_a )
+        {
+            active_a.push_back( k );
+        }
+        else
+        {
+            active_b.push_back( k - na );
+        }
+    }
+
+    std::sort( pairs.begin(), pairs.end() );
+}
@@ -14,10 +14,18 @@
 #include "Vec3d.h"
 
 #include <vector>
+#include <utility>
 
 class BndBox;
 bool Compare( const BndBox& bb1, const BndBox& bb2, double tol = 1.0e-12 );
 
+//==== Sweep and Prune - Index Pairs of Boxes That Compare() True ====//
+// Pairs i < j within one set of boxes, sorted by i then j
+void OverlapPairs( const std::vector< BndBox > & boxes, std::vector< std::pair< int, int > > & pairs, double tol = 1.0e-12 );
+// Pairs ( i, j ) of box i in set a and box j in set b, sorted by i then j
+void OverlapPairs( const std::vector< BndBox > & boxes_a, const std::vector< BndBox > & boxes_b,
+                   std::vector< std::pair< int, int > > & pairs, double tol = 1.0e-12 );
+
 class VSPDLL BndBox
 {
 public:
@@ -100,8 +100,8 @@ double asinhc_approx( const double &y )
 //
 double asinhc( const double &y )
 {
-    static double lasty = -1.0; // Negative argument impossible
-    static double lastx = 0;
+    thread_local double lasty = -1.0; // Negative argument impossible, cached per update thread
+    thread_local double lastx = 0;
 
     if ( y == lasty )
     {
@@ -187,8 +187,8 @@ double asinc_approx( const double &y )
 //
 double asinc( const double &y )
 {
-    static double lasty = -1.0; // Negative argument impossible
-    static double lastx = 0;
+    thread_local double lasty = -1.0; // Negative argument impossible, cached per update thread
+    thread_local double lastx = 0;
 
     if ( y == lasty )
     {
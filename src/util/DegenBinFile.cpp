@@ -0,0 +1,597 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "DegenBinFile.h"
+
+#include <string.h>
+
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+static const size_t CHUNK_KIND_LEN = 16;
+static const size_t ARRAY_NAME_LEN = 24;
+static const size_t FILE_HEADER_SIZE = 32;
+static const size_t CHUNK_HEADER_SIZE = 32;
+static const size_t ATTR_HEADER_SIZE = 16;
+static const size_t ARRAY_HEADER_SIZE = 64;
+
+static const uint32_t ATTR_RECORD = 1;
+static const uint32_t ARRAY_RECORD = 2;
+
+static size_t pad8( size_t n )
+{
+    return ( n + 7 ) & ~( size_t )7;
+}
+
+static vector< string > split_labels( const string & labels )
+{
+    vector< string > vec;
+    size_t start = 0;
+    while ( start < labels.size() )
+    {
+        size_t end = labels.find( ',', start );
+        if ( end == string::npos )
+        {
+            end = labels.size();
+        }
+        vec.push_back( labels.substr( start, end - start ) );
+        start = end + 1;
+    }
+    return vec;
+}
+
+//=====================================================================//
+//======================== DegenBinWriter =============================//
+//=====================================================================//
+
+DegenBinWriter::DegenBinWriter()
+{
+    m_File = NULL;
+    m_WriteError = false;
+    m_NumChunks = 0;
+    m_FileBytes = 0;
+    m_ChunkStart = -1;
+    m_NumAttrs = 0;
+    m_NumArrays = 0;
+    m_ArrayLeft = 0;
+}
+
+DegenBinWriter::~DegenBinWriter()
+{
+    Close();
+}
+
+bool DegenBinWriter::Open( const string & file_name )
+{
+    Close();
+
+    m_File = fopen( file_name.c_str(), "wb" );
+    if ( !m_File )
+    {
+        return false;
+    }
+
+    m_FileName = file_name;
+    m_WriteError = false;
+    m_NumChunks = 0;
+    m_FileBytes = 0;
+    m_ChunkStart = -1;
+
+    char magic[8];
+    memcpy( magic, DEGEN_BIN_MAGIC, 8 );
+    uint32_t version = DEGEN_BIN_VERSION;
+    uint32_t bom = DEGEN_BIN_BOM;
+    uint64_t reserved = 0;
+
+    Write( magic, 1, 8 );
+    Write( &version, sizeof( version ), 1 );
+    Write( &bom, sizeof( bom ), 1 );
+    Write( &m_NumChunks, sizeof( m_NumChunks ), 1 );   // Patched in Close
+    Write( &reserved, sizeof( reserved ), 1 );
+
+    return !m_WriteError;
+}
+
+bool DegenBinWriter::Close()
+{
+    if ( !m_File )
+    {
+        return !m_WriteError;
+    }
+
+    if ( m_ChunkStart >= 0 )
+    {
+        EndChunk();
+    }
+
+    m_FileBytes = Tell();
+
+    //==== Patch Chunk Count ====//
+    Seek( 16 );
+    Write( &m_NumChunks, sizeof( m_NumChunks ), 1 );
+
+    if ( fclose( m_File ) != 0 )
+    {
+        m_WriteError = true;
+    }
+    m_File = NULL;
+
+    //==== Do Not Leave A Truncated File That Looks Valid ====//
+    if ( m_WriteError )
+    {
+        remove( m_FileName.c_str() );
+        m_FileBytes = 0;
+    }
+
+    return !m_WriteError;
+}
+
+void DegenBinWriter::Write( const void* data, size_t size, size_t count )
+{
+    if ( count > 0 && fwrite( data, size, count, m_File ) != count )
+    {
+        m_WriteError = true;
+    }
+}
+
+int64_t DegenBinWriter::Tell()
+{
+#ifdef WIN32
+    return _ftelli64( m_File );
+#else
+    return ftello( m_File );
+#endif
+}
+
+void DegenBinWriter::Seek( int64_t pos )
+{
+#ifdef WIN32
+    int ret = _fseeki64( m_File, pos, SEEK_SET );
+#else
+    int ret = fseeko( m_File, ( off_t )pos, SEEK_SET );
+#endif
+    if ( ret != 0 )
+    {
+        m_WriteError = true;
+    }
+}
+
+void DegenBinWriter::Pad()
+{
+    int64_t pos = Tell();
+    size_t npad = ( size_t )( ( ( pos + 7 ) & ~( int64_t )7 ) - pos );
+    const char zeros[8] = { 0 };
+    Write( zeros, 1, npad );
+}
+
+void DegenBinWriter::BeginChunk( const string & kind )
+{
+    if ( !m_File )
+    {
+        return;
+    }
+
+    if ( m_ChunkStart >= 0 )
+    {
+        EndChunk();
+    }
+
+    m_ChunkStart = Tell();
+    m_NumAttrs = 0;
+    m_NumArrays = 0;
+
+    char kind_buf[CHUNK_KIND_LEN];
+    memset( kind_buf, 0, CHUNK_KIND_LEN );
+    strncpy( kind_buf, kind.c_str(), CHUNK_KIND_LEN - 1 );
+    uint64_t size = 0;
+
+    Write( kind_buf, 1, CHUNK_KIND_LEN );
+    Write( &size, sizeof( size ), 1 );                 // Patched in EndChunk
+    Write( &m_NumAttrs, sizeof( m_NumAttrs ), 1 );
+    Write( &m_NumArrays, sizeof( m_NumArrays ), 1 );
+}
+
+void DegenBinWriter::AddAttr( const string & key, const string & val )
+{
+    if ( !m_File || m_ChunkStart < 0 )
+    {
+        return;
+    }
+
+    uint32_t head[4] = { ATTR_RECORD, ( uint32_t )key.size(), ( uint32_t )val.size(), 0 };
+    uint32_t key_len = head[1];
+    uint32_t val_len = head[2];
+    Write( head, sizeof( uint32_t ), 4 );
+    Write( key.c_str(), 1, key_len );
+    Write( val.c_str(), 1, val_len );
+    Pad();
+
+    m_NumAttrs++;
+}
+
+void DegenBinWriter::BeginArray( const string & name, const string & labels, const vector< uint64_t > & dims )
+{
+    if ( !m_File || m_ChunkStart < 0 )
+    {
+        return;
+    }
+
+    char name_buf[ARRAY_NAME_LEN];
+    memset( name_buf, 0, ARRAY_NAME_LEN );
+    strncpy( name_buf, name.c_str(), ARRAY_NAME_LEN - 1 );
+
+    uint32_t ndim = dims.size();
+    if ( ndim > 3 )
+    {
+        ndim = 3;
+    }
+    uint64_t dim_buf[3] = { 0, 0, 0 };
+    m_ArrayLeft = 1;
+    for ( uint32_t i = 0; i < ndim; i++ )
+    {
+        dim_buf[i] = dims[i];
+        m_ArrayLeft *= dims[i];
+    }
+    if ( ndim == 0 )
+    {
+        m_ArrayLeft = 0;
+    }
+    uint32_t label_len = labels.size();
+    uint32_t head[4] = { ARRAY_RECORD, ndim, label_len, 0 };
+
+    Write( head, sizeof( uint32_t ), 4 );
+    Write( name_buf, 1, ARRAY_NAME_LEN );
+    Write( dim_buf, sizeof( uint64_t ), 3 );
+    Write( labels.c_str(), 1, label_len );
+    Pad();
+
+    m_NumArrays++;
+}
+
+void DegenBinWriter::WriteRow( const double* row, size_t n )
+{
+    if ( !m_File || n > m_ArrayLeft )
+    {
+        return;
+    }
+
+    Write( row, sizeof( double ), n );
+    m_ArrayLeft -= n;
+}
+
+void DegenBinWriter::EndArray()
+{
+    if ( !m_File )
+    {
+        return;
+    }
+
+    //==== Zero Fill Anything The Caller Left Out So Offsets Stay Valid ====//
+    double zero = 0.0;
+    for ( ; m_ArrayLeft > 0; m_ArrayLeft-- )
+    {
+        Write( &zero, sizeof( double ), 1 );
+    }
+}
+
+void DegenBinWriter::AddArray( const string & name, const string & labels, const vector< uint64_t > & dims, const double* data )
+{
+    BeginArray( name, labels, dims );
+    if ( data )
+    {
+        WriteRow( data, m_ArrayLeft );
+    }
+    EndArray();
+}
+
+void DegenBinWriter::EndChunk()
+{
+    if ( !m_File || m_ChunkStart < 0 )
+    {
+        return;
+    }
+
+    int64_t end = Tell();
+    uint64_t size = end - m_ChunkStart;
+
+    Seek( m_ChunkStart + CHUNK_KIND_LEN );
+    Write( &size, sizeof( size ), 1 );
+    Write( &m_NumAttrs, sizeof( m_NumAttrs ), 1 );
+    Write( &m_NumArrays, sizeof( m_NumArrays ), 1 );
+    Seek( end );
+
+    m_ChunkStart = -1;
+    m_NumChunks++;
+}
+
+//=====================================================================//
+//======================== DegenBinReader =============================//
+//=====================================================================//
+
+int DegenBinArray::FindLabel( const string & label ) const
+{
+    for ( int i = 0; i < ( int )m_Labels.size(); i++ )
+    {
+        if ( m_Labels[i] == label )
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+string DegenBinChunk::FindAttr( const string & key ) const
+{
+    for ( int i = 0; i < ( int )m_AttrKeys.size(); i++ )
+    {
+        if ( m_AttrKeys[i] == key )
+        {
+            return m_AttrVals[i];
+        }
+    }
+    return string();
+}
+
+const DegenBinArray* DegenBinChunk::FindArray( const string & name ) const
+{
+    for ( int i = 0; i < ( int )m_Arrays.size(); i++ )
+    {
+        if ( m_Arrays[i].m_Name == name )
+        {
+            return &m_Arrays[i];
+        }
+    }
+    return NULL;
+}
+
+DegenBinReader::DegenBinReader()
+{
+    m_Base = NULL;
+    m_Len = 0;
+#ifdef WIN32
+    m_FileHandle = INVALID_HANDLE_VALUE;
+    m_MapHandle = NULL;
+#else
+    m_FD = -1;
+#endif
+}
+
+DegenBinReader::~DegenBinReader()
+{
+    Close();
+}
+
+bool DegenBinReader::Open( const string & file_name )
+{
+    Close();
+
+#ifdef WIN32
+    m_FileHandle = CreateFileA( file_name.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL );
+    if ( m_FileHandle == INVALID_HANDLE_VALUE )
+    {
+        return false;
+    }
+
+    LARGE_INTEGER size;
+    if ( !GetFileSizeEx( m_FileHandle, &size ) || size.QuadPart == 0 )
+    {
+        Close();
+        return false;
+    }
+    m_Len = ( size_t )size.QuadPart;
+
+    m_MapHandle = CreateFileMappingA( m_FileHandle, NULL, PAGE_READONLY, 0, 0, NULL );
+    if ( !m_MapHandle )
+    {
+        Close();
+        return false;
+    }
+
+    m_Base = ( const char* )MapViewOfFile( m_MapHandle, FILE_MAP_READ, 0, 0, 0 );
+    if ( !m_Base )
+    {
+        Close();
+        return false;
+    }
+#else
+    m_FD = open( file_name.c_str(), O_RDONLY );
+    if ( m_FD < 0 )
+    {
+        return false;
+    }
+
+    struct stat st;
+    if ( fstat( m_FD, &st ) != 0 || st.st_size == 0 )
+    {
+        Close();
+        return false;
+    }
+    m_Len = ( size_t )st.st_size;
+
+    void* addr = mmap( NULL, m_Len, PROT_READ, MAP_SHARED, m_FD, 0 );
+    if ( addr == MAP_FAILED )
+    {
+        Close();
+        return false;
+    }
+    m_Base = ( const char* )addr;
+#endif
+
+    if ( !Parse() )
+    {
+        Close();
+        return false;
+    }
+
+    return true;
+}
+
+void DegenBinReader::Close()
+{
+    m_Chunks.clear();
+
+#ifdef WIN32
+    if ( m_Base )
+    {
+        UnmapViewOfFile( m_Base );
+    }
+    if ( m_MapHandle )
+    {
+        CloseHandle( m_MapHandle );
+    }
+    if ( m_FileHandle != INVALID_HANDLE_VALUE )
+    {
+        CloseHandle( m_FileHandle );
+    }
+    m_MapHandle = NULL;
+    m_FileHandle = INVALID_HANDLE_VALUE;
+#else
+    if ( m_Base )
+    {
+        munmap( ( void* )m_Base, m_Len );
+    }
+    if ( m_FD >= 0 )
+    {
+        close( m_FD );
+    }
+    m_FD = -1;
+#endif
+
+    m_Base = NULL;
+    m_Len = 0;
+}
+
+bool DegenBinReader::Parse()
+{
+    if ( m_Len < FILE_HEADER_SIZE || memcmp( m_Base, DEGEN_BIN_MAGIC, 8 ) != 0 )
+    {
+        return false;
+    }
+
+    uint32_t version, bom;
+    uint64_t num_chunks;
+    memcpy( &version, m_Base + 8, sizeof( version ) );
+    memcpy( &bom, m_Base + 12, sizeof( bom ) );
+    memcpy( &num_chunks, m_Base + 16, sizeof( num_chunks ) );
+
+    if ( version > DEGEN_BIN_VERSION || bom != DEGEN_BIN_BOM )
+    {
+        return false;
+    }
+
+    size_t pos = FILE_HEADER_SIZE;
+
+    for ( uint64_t c = 0; c < num_chunks; c++ )
+    {
+        if ( pos + CHUNK_HEADER_SIZE > m_Len )
+        {
+            return false;
+        }
+
+        DegenBinChunk chunk;
+
+        const char* kind = m_Base + pos;
+        chunk.m_Kind = string( kind, strnlen( kind, CHUNK_KIND_LEN ) );
+
+        uint64_t chunk_size;
+        uint32_t num_attrs, num_arrays;
+        memcpy( &chunk_size, m_Base + pos + CHUNK_KIND_LEN, sizeof( chunk_size ) );
+        memcpy( &num_attrs, m_Base + pos + CHUNK_KIND_LEN + 8, sizeof( num_attrs ) );
+        memcpy( &num_arrays, m_Base + pos + CHUNK_KIND_LEN + 12, sizeof( num_arrays ) );
+
+        size_t chunk_end = pos + chunk_size;
+        if ( chunk_size < CHUNK_HEADER_SIZE || chunk_end > m_Len )
+        {
+            return false;
+        }
+
+        size_t p = pos + CHUNK_HEADER_SIZE;
+
+        //==== Attribute And Array Records In Write Order ====//
+        for ( uint32_t r = 0; r < num_attrs + num_arrays; r++ )
+        {
+            uint32_t head[4];
+            if ( p + sizeof( head ) > chunk_end )
+            {
+                return false;
+            }
+            memcpy( head, m_Base + p, sizeof( head ) );
+
+            if ( head[0] == ATTR_RECORD )
+            {
+                uint32_t key_len = head[1];
+                uint32_t val_len = head[2];
+                p += ATTR_HEADER_SIZE;
+
+                if ( p + key_len + val_len > chunk_end )
+                {
+                    return false;
+                }
+                chunk.m_AttrKeys.push_back( string( m_Base + p, key_len ) );
+                chunk.m_AttrVals.push_back( string( m_Base + p + key_len, val_len ) );
+                p = pad8( p + key_len + val_len );
+            }
+            else if ( head[0] == ARRAY_RECORD )
+            {
+                if ( p + ARRAY_HEADER_SIZE > chunk_end )
+                {
+                    return false;
+                }
+
+                uint32_t ndim = head[1];
+                uint32_t label_len = head[2];
+
+                DegenBinArray arr;
+                const char* name = m_Base + p + sizeof( head );
+                arr.m_Name = string( name, strnlen( name, ARRAY_NAME_LEN ) );
+
+                uint64_t dims[3];
+                memcpy( dims, m_Base + p + sizeof( head ) + ARRAY_NAME_LEN, sizeof( dims ) );
+                p += ARRAY_HEADER_SIZE;
+
+                if ( ndim > 3 || p + label_len > chunk_end )
+                {
+                    return false;
+                }
+
+                arr.m_Size = ndim > 0 ? 1 : 0;
+                for ( uint32_t d = 0; d < ndim; d++ )
+                {
+                    arr.m_Dims.push_back( dims[d] );
+                    arr.m_Size *= dims[d];
+                }
+
+                arr.m_Labels = split_labels( string( m_Base + p, label_len ) );
+                p = pad8( p + label_len );
+
+                if ( p + arr.m_Size * sizeof( double ) > chunk_end )
+                {
+                    return false;
+                }
+                arr.m_Data = ( const double* )( m_Base + p );
+                p += arr.m_Size * sizeof( double );
+
+                chunk.m_Arrays.push_back( arr );
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        m_Chunks.push_back( chunk );
+        pos = chunk_end;
+    }
+
+    return true;
+}
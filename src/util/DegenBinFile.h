@@ -0,0 +1,132 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// DegenBinFile.h: Binary DegenGeom file writer and memory mapped reader
+//
+// File layout - native byte order, every block starts on an 8 byte boundary
+//
+//    File Header   char magic[8] "VSPDEGEN", uint32 version, uint32 byte order mark,
+//                  uint64 number of chunks, uint64 reserved
+//    Chunk         char kind[16], uint64 chunk bytes, uint32 num attrs, uint32 num arrays,
+//                  then attr and array records in the order they were added
+//      Attr        uint32 1, uint32 key len, uint32 value len, uint32 0, key, value, pad
+//      Array       uint32 2, uint32 ndim, uint32 label len, uint32 0, char name[24],
+//                  uint64 dims[3], comma separated column labels, pad,
+//                  float64 data[ dims product ]
+//
+// Chunks are written one at a time and sizes are patched when each closes,
+// so components stream to disk.  Offsets are 64 bit on every platform.  If a
+// write fails Close removes the partial file and returns false.  The reader
+// maps the file and hands out pointers straight into the mapping.
+//
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(VSPDEGENBINFILE__INCLUDED_)
+#define VSPDEGENBINFILE__INCLUDED_
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+using std::string;
+using std::vector;
+
+#define DEGEN_BIN_MAGIC "VSPDEGEN"
+#define DEGEN_BIN_VERSION 1
+#define DEGEN_BIN_BOM 0x01020304
+
+class DegenBinWriter
+{
+public:
+    DegenBinWriter();
+    virtual ~DegenBinWriter();
+
+    bool Open( const string & file_name );
+    bool Close();
+    bool IsOpen()                                   { return m_File != NULL; }
+    uint64_t GetFileBytes()                         { return m_FileBytes; }
+
+    void BeginChunk( const string & kind );
+    void AddAttr( const string & key, const string & val );
+    void AddArray( const string & name, const string & labels, const vector< uint64_t > & dims, const double* data );
+    void EndChunk();
+
+    // Row writer for arrays built on the fly - BeginArray, WriteRow x dims[0], EndArray
+    void BeginArray( const string & name, const string & labels, const vector< uint64_t > & dims );
+    void WriteRow( const double* row, size_t n );
+    void EndArray();
+
+protected:
+
+    void Pad();
+    void Write( const void* data, size_t size, size_t count );
+    int64_t Tell();
+    void Seek( int64_t pos );
+
+    FILE* m_File;
+    string m_FileName;
+    bool m_WriteError;
+    uint64_t m_NumChunks;
+    uint64_t m_FileBytes;
+
+    int64_t m_ChunkStart;
+    uint32_t m_NumAttrs;
+    uint32_t m_NumArrays;
+
+    uint64_t m_ArrayLeft;
+};
+
+struct DegenBinArray
+{
+    string m_Name;
+    vector< string > m_Labels;
+    vector< uint64_t > m_Dims;
+    uint64_t m_Size;
+    const double* m_Data;           // Points into the mapped file
+
+    int FindLabel( const string & label ) const;
+};
+
+struct DegenBinChunk
+{
+    string m_Kind;
+    vector< string > m_AttrKeys;
+    vector< string > m_AttrVals;
+    vector< DegenBinArray > m_Arrays;
+
+    string FindAttr( const string & key ) const;
+    const DegenBinArray* FindArray( const string & name ) const;
+};
+
+class DegenBinReader
+{
+public:
+    DegenBinReader();
+    virtual ~DegenBinReader();
+
+    bool Open( const string & file_name );
+    void Close();
+
+    const vector< DegenBinChunk > & GetChunks() const { return m_Chunks; }
+
+protected:
+
+    bool Parse();
+
+    const char* m_Base;
+    size_t m_Len;
+
+#ifdef WIN32
+    void* m_FileHandle;
+    void* m_MapHandle;
+#else
+    int m_FD;
+#endif
+
+    vector< DegenBinChunk > m_Chunks;
+};
+
+#endif // !defined(VSPDEGENBINFILE__INCLUDED_)
@@ -256,6 +256,16 @@ void Matrix4d::xformvec( std::vector < vec3d > & in ) const
     }
 }
 
+// Rotation only -- for directions and normals of rigid transforms
+vec3d Matrix4d::xformnorm( const vec3d & in ) const
+{
+    vec3d out;
+    out[0] = mat[0] * in[0] + mat[4] * in[1] + mat[8] * in[2];
+    out[1] = mat[1] * in[0] + mat[5] * in[1] + mat[9] * in[2];
+    out[2] = mat[2] * in[0] + mat[6] * in[1] + mat[10] * in[2];
+    return out;
+}
+
 vec3d Matrix4d::getAngles() const
 {
     vec3d angles;
@@ -12,8 +12,9 @@
 #endif
 
 #ifdef WIN32
-
+#include <psapi.h>
 #else
+#include <sys/resource.h>
 #include <sys/wait.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -32,8 +33,33 @@ void SleepForMilliseconds( unsigned int sleep_time)
 #endif
 }
 
+size_t GetPeakMemoryUsage()
+{
+#ifdef WIN32
+    PROCESS_MEMORY_COUNTERS pmc;
+    if ( GetProcessMemoryInfo( GetCurrentProcess(), &pmc, sizeof( pmc ) ) )
+    {
+        return ( size_t )pmc.PeakWorkingSetSize;
+    }
+    return 0;
+#else
+    struct rusage usage;
+    if ( getrusage( RUSAGE_SELF, &usage ) != 0 )
+    {
+        return 0;
+    }
+#ifdef __APPLE__
+    return ( size_t )usage.ru_maxrss;           // Bytes
+#else
+    return ( size_t )usage.ru_maxrss * 1024;    // Kilobytes
+#endif
+#endif
+}
+
 ProcessUtil::ProcessUtil()
 {
+    m_ExitStatus = 0;
+
 #ifdef WIN32
     ZeroMemory( &si, sizeof(si) );
     si.cb = sizeof(si);
@@ -50,6 +76,20 @@ ProcessUtil::ProcessUtil()
 }
 
 #ifndef WIN32
+// Exit code from a waitpid status, negative signal number if the child was killed
+static int WaitStatusToExitStatus( int status )
+{
+    if ( WIFEXITED( status ) )
+    {
+        return WEXITSTATUS( status );
+    }
+    if ( WIFSIGNALED( status ) )
+    {
+        return -WTERMSIG( status );
+    }
+    return 0;
+}
+
 // C++ wrapper for execv.
 // Note, this automatically makes cmd the first argument in the list.
 // This also automatically NULL terminates the list of arguments.
@@ -142,6 +182,7 @@ string ProcessUtil::QuoteString( const string &str )
 
 int ProcessUtil::ForkCmd( const string &path, const string &cmd, const vector<string> &opts )
 {
+    m_ExitStatus = 0;
 
 #ifdef WIN32
 
@@ -259,6 +300,10 @@ void ProcessUtil::WaitCmd( void *(*updatefun)( void *data ), void *data )
 
         if ( ret == WAIT_OBJECT_0 )
         {
+            DWORD code = 0;
+            GetExitCodeProcess( pi.hProcess, &code );
+            m_ExitStatus = ( int )code;
+
             CloseHandle( pi.hProcess );
             CloseHandle( pi.hThread );
             ZeroMemory( &pi, sizeof(pi) );
@@ -271,6 +316,7 @@ void ProcessUtil::WaitCmd( void *(*updatefun)( void *data ), void *data )
 
         if  (retpid == childPid )
         {
+            m_ExitStatus = WaitStatusToExitStatus( status );
             childPid = -1;
             waitFlag = 0;
         }
@@ -313,6 +359,10 @@ bool ProcessUtil::IsRunning()
 
         if ( ret == WAIT_OBJECT_0 )
         {
+            DWORD code = 0;
+            GetExitCodeProcess( pi.hProcess, &code );
+            m_ExitStatus = ( int )code;
+
             CloseHandle( pi.hProcess );
             CloseHandle( pi.hThread );
             ZeroMemory( &pi, sizeof(pi) );
@@ -332,6 +382,7 @@ bool ProcessUtil::IsRunning()
 
         if  (retpid == childPid )
         {
+            m_ExitStatus = WaitStatusToExitStatus( status );
             childPid = -1;
             return false;
         }
@@ -24,6 +24,9 @@ using std::vector;
 
 void SleepForMilliseconds( unsigned int sleep_time);
 
+// Peak resident memory of this process in bytes, 0 if unavailable
+size_t GetPeakMemoryUsage();
+
 class ProcessUtil
 {
 public:
@@ -39,6 +42,13 @@ public:
 
     bool IsRunning();
 
+    // Exit code of the last command once IsRunning() has returned false,
+    // negative if it was killed by a signal
+    int GetExitStatus()
+    {
+        return m_ExitStatus;
+    }
+
     void ReadStdoutPipe(char * buf, int bufsize, unsigned long * nread );
 
     string PrettyCmd( const string &path, const string &cmd, const vector<string> &opts ); //returns a command string that could be used on the command line
@@ -56,6 +66,8 @@ public:
 
 private:
 
+    int m_ExitStatus;
+
 #ifdef WIN32
     STARTUPINFO si;
     PROCESS_INFORMATION pi;
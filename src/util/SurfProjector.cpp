@@ -0,0 +1,216 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+//////////////////////////////////////////////////////////////////////
+// SurfProjector.cpp
+//////////////////////////////////////////////////////////////////////
+
+#include "SurfProjector.h"
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <limits>
+#include <cmath>
+
+#define SURF_PROJ_CHUNK 256         // Points Per Thread Pool Task
+#define SURF_PROJ_TOL 1.0e-12       // Distance Treated As On The Surface
+#define SURF_PROJ_EDGE_TOL 1.0e-10  // Parameter Distance Treated As On An Edge
+
+SurfProjector::SurfProjector()
+{
+    m_Surf = NULL;
+    m_Tree = NULL;
+}
+
+SurfProjector::~SurfProjector()
+{
+    delete m_Tree;
+}
+
+void SurfProjector::Build( const VspSurf* surf, int num_per_patch )
+{
+    m_Surf = surf;
+
+    delete m_Tree;
+    m_Tree = NULL;
+
+    m_Cloud.m_PntNodes.clear();
+    m_UVec.clear();
+    m_WVec.clear();
+
+    surf->GetBoundingBox( m_BBox );
+
+    int nu = std::max( surf->GetNumSectU(), 1 ) * num_per_patch + 1;
+    int nw = std::max( surf->GetNumSectW(), 1 ) * num_per_patch + 1;
+
+    double umax = surf->GetUMax();
+    double wmax = surf->GetWMax();
+
+    m_Cloud.m_PntNodes.reserve( nu * nw );
+    m_UVec.reserve( nu * nw );
+    m_WVec.reserve( nu * nw );
+
+    for ( int i = 0 ; i < nu ; i++ )
+    {
+        double u = umax * ( double )i / ( double )( nu - 1 );
+        for ( int j = 0 ; j < nw ; j++ )
+        {
+            double w = wmax * ( double )j / ( double )( nw - 1 );
+
+            m_Cloud.m_PntNodes.push_back( PntNode( surf->CompPnt( u, w ) ) );
+            m_UVec.push_back( u );
+            m_WVec.push_back( w );
+        }
+    }
+
+    m_Tree = new PNTree( 3, m_Cloud, KDTreeSingleIndexAdaptorParams( 10 ) );
+    m_Tree->buildIndex();
+
+    //==== Boundary Curves - u = 0, u = max, w = 0, w = max ====//
+    surf->GetUConstCurve( m_EdgeCrv[0], 0.0 );
+    surf->GetUConstCurve( m_EdgeCrv[1], umax );
+    surf->GetWConstCurve( m_EdgeCrv[2], 0.0 );
+    surf->GetWConstCurve( m_EdgeCrv[3], wmax );
+}
+
+double SurfProjector::Project01( const vec3d & pt, double & u, double & w ) const
+{
+    double dist;
+
+    //==== Seed From Nearest Sample ====//
+    size_t isample;
+    double dsample_sqr;
+    m_Tree->knnSearch( pt.v, 1, &isample, &dsample_sqr );
+
+    dist = m_Surf->FindNearest( u, w, pt, m_UVec[isample], m_WVec[isample] );
+
+    //==== Newton Stalls On A Boundary - Polish Along The Edge Curve ====//
+    double umax = m_Surf->GetUMax();
+    double wmax = m_Surf->GetWMax();
+
+    if ( u <= SURF_PROJ_EDGE_TOL || u >= umax - SURF_PROJ_EDGE_TOL )
+    {
+        int iedge = u <= SURF_PROJ_EDGE_TOL ? 0 : 1;
+        double wt;
+        double d = m_EdgeCrv[iedge].FindNearest( wt, pt, w );
+        if ( d < dist )
+        {
+            dist = d;
+            u = iedge == 0 ? 0.0 : umax;
+            w = wt;
+        }
+    }
+
+    if ( w <= SURF_PROJ_EDGE_TOL || w >= wmax - SURF_PROJ_EDGE_TOL )
+    {
+        int iedge = w <= SURF_PROJ_EDGE_TOL ? 2 : 3;
+        double ut;
+        double d = m_EdgeCrv[iedge].FindNearest( ut, pt, u );
+        if ( d < dist )
+        {
+            dist = d;
+            u = ut;
+            w = iedge == 2 ? 0.0 : wmax;
+        }
+    }
+
+    //==== Newton Wandered Off - Fall Back To The Full Search ====//
+    if ( dist * dist > dsample_sqr + SURF_PROJ_TOL )
+    {
+        dist = m_Surf->FindNearest( u, w, pt );
+    }
+
+    u = u / umax;
+    w = w / wmax;
+
+    return dist;
+}
+
+double SurfProjector::BoxDist( const vec3d & pt ) const
+{
+    return ::BoxDist( m_BBox, pt );
+}
+
+double BoxDist( const BndBox & box, const vec3d & pt )
+{
+    double d2 = 0.0;
+    for ( int k = 0 ; k < 3 ; k++ )
+    {
+        double d = std::max( std::max( box.GetMin( k ) - pt[k], pt[k] - box.GetMax( k ) ), 0.0 );
+        d2 += d * d;
+    }
+    return sqrt( d2 );
+}
+
+void ProjectVecPnt01( const vector< const VspSurf* > & surf_vec, const vector< vec3d > & pts,
+                      vector< int > & surf_indx_vec, vector< double > & u_vec, vector< double > & w_vec,
+                      vector< double > & d_vec, int num_threads )
+{
+    int npts = ( int )pts.size();
+    int nsurf = ( int )surf_vec.size();
+
+    surf_indx_vec.assign( npts, -1 );
+    u_vec.assign( npts, 0.0 );
+    w_vec.assign( npts, 0.0 );
+    d_vec.assign( npts, std::numeric_limits< double >::max() );
+
+    if ( npts == 0 || nsurf == 0 )
+    {
+        return;
+    }
+
+    int num_chunks = ( npts + SURF_PROJ_CHUNK - 1 ) / SURF_PROJ_CHUNK;
+    ThreadPool pool( num_chunks > 1 ? num_threads : 1 );
+
+    //==== Sample Trees, One Surface Per Task ====//
+    vector< SurfProjector > proj_vec( nsurf );
+    pool.Run( nsurf, [&]( int s )
+    {
+        proj_vec[s].Build( surf_vec[s] );
+    } );
+
+    pool.Run( num_chunks, [&]( int c )
+    {
+        int begin = c * SURF_PROJ_CHUNK;
+        int end = std::min( begin + SURF_PROJ_CHUNK, npts );
+
+        vector< pair< double, int > > box_order( nsurf );
+
+        for ( int i = begin ; i < end ; i++ )
+        {
+            //==== Nearest Boxes First, Stop Once A Box Is Farther Than The Best ====//
+            for ( int s = 0 ; s < nsurf ; s++ )
+            {
+                box_order[s] = make_pair( proj_vec[s].BoxDist( pts[i] ), s );
+            }
+            std::sort( box_order.begin(), box_order.end() );
+
+            for ( int k = 0 ; k < nsurf ; k++ )
+            {
+                if ( box_order[k].first >= d_vec[i] )
+                {
+                    break;
+                }
+
+                int s = box_order[k].second;
+                double u, w;
+                double d = proj_vec[s].Project01( pts[i], u, w );
+
+                if ( d < d_vec[i] )
+                {
+                    d_vec[i] = d;
+                    u_vec[i] = u;
+                    w_vec[i] = w;
+                    surf_indx_vec[i] = s;
+
+                    if ( d < SURF_PROJ_TOL )
+                    {
+                        break;
+                    }
+                }
+            }
+        }
+    } );
+}
@@ -0,0 +1,80 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+//////////////////////////////////////////////////////////////////////
+// SurfProjector.h
+//
+// Point projection onto a VspSurf for large batches of points.  A grid
+// of surface samples is put in a kd-tree once, and each projection is a
+// single Newton solve seeded from the nearest sample.  Answers that land
+// on a boundary are polished along the edge curve, as the full search
+// does.  The full patch-by-patch search is only used when the seeded
+// solve ends up farther away than the sample it started from.
+//
+// Project01() is const and may be called from many threads at once.
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(SURF_PROJECTOR__INCLUDED_)
+#define SURF_PROJECTOR__INCLUDED_
+
+#include "VspSurf.h"
+#include "BndBox.h"
+#include "PntNodeMerge.h"
+
+#include <vector>
+using std::vector;
+
+class SurfProjector
+{
+public:
+
+    SurfProjector();
+    virtual ~SurfProjector();
+
+    // num_per_patch samples in each direction of each surface patch
+    void Build( const VspSurf* surf, int num_per_patch = 4 );
+
+    // Nearest point in 0-1 parameter space, returns the distance
+    double Project01( const vec3d & pt, double & u, double & w ) const;
+
+    // Distance from pt to the surface bounding box, zero inside
+    double BoxDist( const vec3d & pt ) const;
+
+    const BndBox & GetBndBox() const
+    {
+        return m_BBox;
+    }
+
+protected:
+
+    const VspSurf* m_Surf;
+
+    PntNodeCloud m_Cloud;
+    PNTree* m_Tree;
+
+    vector< double > m_UVec;
+    vector< double > m_WVec;
+
+    VspCurve m_EdgeCrv[4];
+
+    BndBox m_BBox;
+
+private:
+
+    SurfProjector( const SurfProjector& );
+    SurfProjector& operator=( const SurfProjector& );
+};
+
+// Distance from pt to box, zero inside
+double BoxDist( const BndBox & box, const vec3d & pt );
+
+// Project each point onto the nearest of surf_vec, skipping surfaces whose
+// bounding box is already farther away than the best projection so far.
+// Points are split over num_threads ( <= 0 for one per core ).
+void ProjectVecPnt01( const vector< const VspSurf* > & surf_vec, const vector< vec3d > & pts,
+                      vector< int > & surf_indx_vec, vector< double > & u_vec, vector< double > & w_vec,
+                      vector< double > & d_vec, int num_threads = 0 );
+
+#endif
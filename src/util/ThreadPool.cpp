@@ -0,0 +1,105 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+ThreadPool::ThreadPool( int num_threads )
+{
+    if ( num_threads <= 0 )
+    {
+        num_threads = GetNumHardwareThreads();
+    }
+    m_NumThreads = num_threads;
+}
+
+ThreadPool::~ThreadPool()
+{
+}
+
+int ThreadPool::GetNumHardwareThreads()
+{
+    int n = ( int )std::thread::hardware_concurrency();
+    if ( n < 1 )
+    {
+        n = 1;
+    }
+    return n;
+}
+
+void ThreadPool::Run( int num_tasks, const std::function< void( int ) > & task )
+{
+    vector< int > order( num_tasks );
+    for ( int i = 0 ; i < num_tasks ; i++ )
+    {
+        order[i] = i;
+    }
+    Run( order, task );
+}
+
+void ThreadPool::Run( const vector< int > & order, const std::function< void( int ) > & task )
+{
+    int num_tasks = ( int )order.size();
+    int num_threads = std::min( m_NumThreads, num_tasks );
+
+    //==== Nothing to share - run on the calling thread ====//
+    if ( num_threads <= 1 )
+    {
+        for ( int i = 0 ; i < num_tasks ; i++ )
+        {
+            task( order[i] );
+        }
+        return;
+    }
+
+    std::atomic< int > next( 0 );
+    std::exception_ptr error;
+    std::mutex error_mutex;
+
+    auto worker = [&]()
+    {
+        int i;
+        while ( ( i = next++ ) < num_tasks )
+        {
+            try
+            {
+                task( order[i] );
+            }
+            catch ( ... )
+            {
+                //==== Keep the first failure, skip the tasks not yet started ====//
+                std::lock_guard< std::mutex > lock( error_mutex );
+                if ( !error )
+                {
+                    error = std::current_exception();
+                }
+                next = num_tasks;
+            }
+        }
+    };
+
+    //==== Calling thread works too ====//
+    vector< std::thread > threads;
+    for ( int t = 1 ; t < num_threads ; t++ )
+    {
+        threads.push_back( std::thread( worker ) );
+    }
+    worker();
+
+    for ( int t = 0 ; t < ( int )threads.size() ; t++ )
+    {
+        threads[t].join();
+    }
+
+    if ( error )
+    {
+        std::rethrow_exception( error );
+    }
+}
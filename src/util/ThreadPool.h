@@ -0,0 +1,49 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+//////////////////////////////////////////////////////////////////////
+// ThreadPool.h
+//
+// Runs a batch of independent tasks on a pool of worker threads.  Tasks
+// are handed out one at a time, in the order given, to whichever thread
+// is free next.  Run() returns once every task has finished.
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(THREAD_POOL__INCLUDED_)
+#define THREAD_POOL__INCLUDED_
+
+#include <functional>
+#include <vector>
+
+using std::vector;
+
+class ThreadPool
+{
+public:
+
+    // num_threads <= 0 uses one thread per hardware core
+    ThreadPool( int num_threads = 0 );
+    virtual ~ThreadPool();
+
+    int GetNumThreads()
+    {
+        return m_NumThreads;
+    }
+
+    //==== Call task( order[0] ), task( order[1] ), ... ====//
+    void Run( const vector< int > & order, const std::function< void( int ) > & task );
+
+    //==== Call task( 0 ) ... task( num_tasks - 1 ) ====//
+    void Run( int num_tasks, const std::function< void( int ) > & task );
+
+    static int GetNumHardwareThreads();
+
+protected:
+
+    int m_NumThreads;
+
+};
+
+#endif
@@ -16,7 +16,7 @@ string GenerateRandomID( int length )
         srand( ( unsigned int )time( NULL ) );
     }
 
-    static char str[256];
+    char str[256];
     for ( int i = 0 ; i < length ; i++ )
     {
         str[i] = ( char )( ( rand() % 26 ) + 65 );
@@ -32,6 +32,39 @@ bool ToBool( double val )
     return false;
 }
 
+//==== Fold Bytes Into A 64 Bit FNV-1a Hash ====//
+unsigned long long HashBytes( const void* data, size_t n, unsigned long long hash )
+{
+    const unsigned char* c = ( const unsigned char* )data;
+    for ( size_t i = 0 ; i < n ; i++ )
+    {
+        hash ^= c[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+unsigned long long HashInt( int val, unsigned long long hash )
+{
+    return HashBytes( &val, sizeof( val ), hash );
+}
+
+unsigned long long HashDouble( double val, unsigned long long hash )
+{
+    // -0.0 and 0.0 compare equal, so hash them the same
+    if ( val == 0.0 )
+    {
+        val = 0.0;
+    }
+    return HashBytes( &val, sizeof( val ), hash );
+}
+
+unsigned long long HashString( const string & str, unsigned long long hash )
+{
+    hash = HashInt( ( int )str.size(), hash );
+    return HashBytes( str.data(), str.size(), hash );
+}
+
 double mag( double x )
 {
     if ( x == 0 )
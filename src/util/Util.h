@@ -38,6 +38,14 @@ extern string GenerateRandomID( int length );
 
 extern bool ToBool( double val );
 
+//==== 64 Bit FNV-1a Hash, Chained Through The Hash Argument ====//
+#define HASH_SEED 14695981039346656037ULL
+
+unsigned long long HashBytes( const void* data, size_t n, unsigned long long hash = HASH_SEED );
+unsigned long long HashInt( int val, unsigned long long hash = HASH_SEED );
+unsigned long long HashDouble( double val, unsigned long long hash = HASH_SEED );
+unsigned long long HashString( const string & str, unsigned long long hash = HASH_SEED );
+
 double mag( double x );
 double magrounddn( double x );
 double magroundup( double x );
@@ -8,8 +8,13 @@
 #include "UtilTestSuite.h"
 
 #include <float.h>
+#include <stdexcept>
 #include "StringUtil.h"
 #include "StlHelper.h"
+#include "ThreadPool.h"
+#include "BndBox.h"
+#include "DegenBinFile.h"
+#include <algorithm>
 
 
 //==== Test vec2d ====//
@@ -665,3 +670,180 @@ void UtilTestSuite::BilinearInterpTest()
     TEST_ASSERT_DELTA( interp_val, 9.8125, DBL_EPSILON );
 
 }
+
+void UtilTestSuite::ThreadPoolTest()
+{
+    int num_tasks = 1000;
+
+    //==== Each task runs exactly once, for any number of threads ====//
+    for ( int nthread = 1 ; nthread <= 8 ; nthread *= 2 )
+    {
+        ThreadPool pool( nthread );
+        TEST_ASSERT( pool.GetNumThreads() == nthread );
+
+        vector< int > count( num_tasks, 0 );
+        pool.Run( num_tasks, [&]( int i )
+        {
+            count[i]++;
+        } );
+
+        int num_bad = 0;
+        for ( int i = 0 ; i < num_tasks ; i++ )
+        {
+            if ( count[i] != 1 )
+            {
+                num_bad++;
+            }
+        }
+        TEST_ASSERT( num_bad == 0 );
+    }
+
+    //==== Task order is honored on one thread ====//
+    vector< int > order;
+    order.push_back( 2 );
+    order.push_back( 0 );
+    order.push_back( 1 );
+
+    vector< int > visit;
+    ThreadPool serial( 1 );
+    serial.Run( order, [&]( int i )
+    {
+        visit.push_back( i );
+    } );
+    TEST_ASSERT( visit == order );
+
+    //==== A failing task is reported to the caller ====//
+    ThreadPool pool( 4 );
+    bool caught = false;
+    try
+    {
+        pool.Run( num_tasks, [&]( int i )
+        {
+            if ( i == num_tasks / 2 )
+            {
+                throw std::runtime_error( "task failed" );
+            }
+        } );
+    }
+    catch ( std::runtime_error & )
+    {
+        caught = true;
+    }
+    TEST_ASSERT( caught );
+
+    TEST_ASSERT( ThreadPool::GetNumHardwareThreads() >= 1 );
+}
+
+void UtilTestSuite::OverlapPairsTest()
+{
+    //==== Random boxes, some of them flat ====//
+    srand( 1234 );
+    vector< BndBox > boxes_a( 200 );
+    vector< BndBox > boxes_b( 150 );
+    for ( int i = 0 ; i < ( int )( boxes_a.size() + boxes_b.size() ) ; i++ )
+    {
+        vec3d p( rand() % 100, rand() % 100, rand() % 100 );
+        vec3d d( rand() % 10, rand() % 10, ( i % 7 == 0 ) ? 0 : rand() % 10 );
+
+        BndBox & box = ( i < ( int )boxes_a.size() ) ? boxes_a[i] : boxes_b[ i - boxes_a.size() ];
+        box.Update( p );
+        box.Update( p + d );
+    }
+
+    //==== Same pairs, in the same order, as the brute force loops ====//
+    vector< pair< int, int > > brute;
+    for ( int i = 0 ; i < ( int )boxes_a.size() ; i++ )
+    {
+        for ( int j = i + 1 ; j < ( int )boxes_a.size() ; j++ )
+        {
+            if ( Compare( boxes_a[i], boxes_a[j] ) )
+            {
+                brute.push_back( pair< int, int >( i, j ) );
+            }
+        }
+    }
+
+    vector< pair< int, int > > pairs;
+    OverlapPairs( boxes_a, pairs );
+    TEST_ASSERT( brute.size() > 0 );
+    TEST_ASSERT( pairs == brute );
+
+    brute.clear();
+    for ( int i = 0 ; i < ( int )boxes_a.size() ; i++ )
+    {
+        for ( int j = 0 ; j < ( int )boxes_b.size() ; j++ )
+        {
+            if ( Compare( boxes_a[i], boxes_b[j] ) )
+            {
+                brute.push_back( pair< int, int >( i, j ) );
+            }
+        }
+    }
+
+    OverlapPairs( boxes_a, boxes_b, pairs );
+    TEST_ASSERT( brute.size() > 0 );
+    TEST_ASSERT( pairs == brute );
+}
+
+void UtilTestSuite::DegenBinFileTest()
+{
+    string file_name = "DegenBinFileTest.bin";
+
+    //==== Streamed rows and a whole array, attrs between them ====//
+    vector< uint64_t > dims;
+    dims.push_back( 3 );
+    dims.push_back( 4 );
+    dims.push_back( 5 );
+
+    vector< double > vals( 60 );
+    for ( int i = 0 ; i < ( int )vals.size() ; i++ )
+    {
+        vals[i] = 0.1 * i - 2.0;
+    }
+
+    DegenBinWriter writer;
+    TEST_ASSERT( writer.Open( file_name ) );
+
+    writer.BeginChunk( "BODY" );
+    writer.AddAttr( "name", "Fuse" );
+    writer.BeginArray( "SURFACE_NODE", "x,y,z,u,w", dims );
+    for ( int i = 0 ; i < 12 ; i++ )
+    {
+        writer.WriteRow( &vals[ i * 5 ], 5 );
+    }
+    writer.EndArray();
+    writer.AddAttr( "geom_id", "ABCDEFG" );
+    dims.resize( 2 );
+    dims[0] = 1;
+    dims[1] = 3;
+    writer.AddArray( "POINT", "a,b,c", dims, &vals[0] );
+    writer.EndChunk();
+
+    writer.BeginChunk( "DISK" );
+    writer.EndChunk();
+    TEST_ASSERT( writer.Close() );
+
+    DegenBinReader reader;
+    TEST_ASSERT( reader.Open( file_name ) );
+
+    const vector< DegenBinChunk > & chunks = reader.GetChunks();
+    TEST_ASSERT( chunks.size() == 2 );
+    TEST_ASSERT( chunks[0].m_Kind == "BODY" );
+    TEST_ASSERT( chunks[1].m_Kind == "DISK" );
+    TEST_ASSERT( chunks[0].FindAttr( "name" ) == "Fuse" );
+    TEST_ASSERT( chunks[0].FindAttr( "geom_id" ) == "ABCDEFG" );
+
+    const DegenBinArray* arr = chunks[0].FindArray( "SURFACE_NODE" );
+    TEST_ASSERT( arr != NULL );
+    TEST_ASSERT( arr->m_Dims.size() == 3 && arr->m_Size == 60 );
+    TEST_ASSERT( arr->FindLabel( "w" ) == 4 );
+    TEST_ASSERT( ( ( size_t )arr->m_Data ) % sizeof( double ) == 0 );
+    TEST_ASSERT( std::equal( vals.begin(), vals.end(), arr->m_Data ) );
+
+    arr = chunks[0].FindArray( "POINT" );
+    TEST_ASSERT( arr != NULL && arr->m_Size == 3 );
+    TEST_ASSERT_DELTA( arr->m_Data[2], vals[2], DBL_EPSILON );
+
+    reader.Close();
+    remove( file_name.c_str() );
+}
@@ -47,6 +47,7 @@ VspSurf::VspSurf()
     m_CloneIndex = -1;
 
     SetClustering( 1.0, 1.0 );
+    SetAdaptTess( 0.0, 10.0, 4 );
 
     m_FoilSurf = NULL;
 }
@@ -68,6 +69,13 @@ void VspSurf::SetRootTipClustering( const vector < double > &root, const vector
     m_TipCluster = tip;
 }
 
+void VspSurf::SetAdaptTess( double chord_tol, double angle_tol, int max_pass )
+{
+    m_AdaptChordTol = chord_tol;
+    m_AdaptAngleTol = angle_tol;
+    m_AdaptMaxPass = max_pass;
+}
+
 int VspSurf::GetNumSectU() const
 {
     return m_Surface.number_u_patches();
@@ -902,6 +910,73 @@ void VspSurf::SetWSkipLast( bool f )
     }
 }
 
+//==== Fold Everything That Shapes A Tessellation Into A Hash ====//
+unsigned long long VspSurf::GetHash( unsigned long long hash )
+{
+    piecewise_surface_type::index_type ip, jp, nupatch, nvpatch;
+
+    nupatch = m_Surface.number_u_patches();
+    nvpatch = m_Surface.number_v_patches();
+
+    hash = HashInt( ( int )nupatch, hash );
+    hash = HashInt( ( int )nvpatch, hash );
+    hash = HashInt( m_FlipNormal, hash );
+    hash = HashInt( m_MagicVParm, hash );
+    hash = HashInt( m_HalfBOR, hash );
+    hash = HashInt( m_SurfType, hash );
+    hash = HashInt( m_SurfCfdType, hash );
+
+    vector< double > pmap;
+    m_Surface.get_pmap_u( pmap );
+    for ( int i = 0 ; i < ( int )pmap.size() ; i++ )
+    {
+        hash = HashDouble( pmap[i], hash );
+    }
+    m_Surface.get_pmap_v( pmap );
+    for ( int i = 0 ; i < ( int )pmap.size() ; i++ )
+    {
+        hash = HashDouble( pmap[i], hash );
+    }
+
+    for( ip = 0; ip < nupatch; ++ip )
+    {
+        for( jp = 0; jp < nvpatch; ++jp )
+        {
+            surface_patch_type::index_type icp, jcp, nu, nv;
+
+            surface_patch_type *patch = m_Surface.get_patch( ip, jp );
+
+            nu = patch->degree_u();
+            nv = patch->degree_v();
+
+            hash = HashInt( ( int )nu, hash );
+            hash = HashInt( ( int )nv, hash );
+
+            for( icp = 0; icp <= nu; ++icp )
+            {
+                for( jcp = 0; jcp <= nv; ++jcp )
+                {
+                    surface_patch_type::point_type p = patch->get_control_point( icp, jcp );
+                    hash = HashDouble( p.x(), hash );
+                    hash = HashDouble( p.y(), hash );
+                    hash = HashDouble( p.z(), hash );
+                }
+            }
+        }
+    }
+
+    for ( int i = 0 ; i < ( int )m_UFeature.size() ; i++ )
+    {
+        hash = HashDouble( m_UFeature[i], hash );
+    }
+    for ( int i = 0 ; i < ( int )m_WFeature.size() ; i++ )
+    {
+        hash = HashDouble( m_WFeature[i], hash );
+    }
+
+    return hash;
+}
+
 void VspSurf::FlagDuplicate( VspSurf *othersurf )
 {
     piecewise_surface_type::index_type ip, jp, nupatch, nvpatch;
@@ -1280,6 +1355,9 @@ void VspSurf::Tesselate( const vector<int> &num_u, int num_v, std::vector< vecto
     MakeVTess( num_v, v, n_cap, degen );
     MakeUTess( num_u, u, umerge );
 
+    // DegenGeom relies on the W points matching the airfoil and the LE index
+    AdaptTess( u, v, !degen );
+
     Tesselate( u, v, pnts, norms, uw_pnts );
 }
 
@@ -1295,6 +1373,8 @@ void VspSurf::SplitTesselate( const vector<int> &num_u, int num_v, std::vector<
     MakeVTess( num_v, v, n_cap, false );
     MakeUTess( num_u, u, umerge );
 
+    AdaptTess( u, v, true );
+
     SplitTesselate( m_UFeature, m_WFeature, u, v, pnts, norms );
 }
 
@@ -1307,6 +1387,52 @@ void VspSurf::Tesselate( const vector<double> &u, const vector<double> &v, std::
 
     m_Surface.f_pt_normal_grid( u, v, ptmat, nmat);
 
+    //==== Zero Normals At The Blunt TE And LE Are Taken Just Off The Edge ====//
+    // One grid evaluation covers every W line that needs it.
+    double tmax = GetWMax();
+    double thalf = 0.5 * GetWMax();
+    vector < double > vfix;
+    vector < int > jfix( nv, -1 );
+    for ( surface_index_type j = 0; j < nv; j++ )
+    {
+        bool zero = false;
+        for ( surface_index_type i = 0; i < nu && !zero; i++ )
+        {
+            zero = ( nmat[i][j].norm() < 1e-6 );
+        }
+        if ( !zero )
+        {
+            continue;
+        }
+
+        if ( v[j] <= TMAGIC ) // Near TE lower
+        {
+            jfix[j] = vfix.size();
+            vfix.push_back( TMAGIC + 1e-6 );
+        }
+        else if ( v[j] <= thalf && v[j] >= ( thalf - TMAGIC ) ) // Near leading edge
+        {
+            jfix[j] = vfix.size();
+            vfix.push_back( thalf - ( TMAGIC + 1e-6 ) );
+        }
+        else if ( v[j] >= thalf && v[j] <= ( thalf + TMAGIC ) ) // Near leading edge
+        {
+            jfix[j] = vfix.size();
+            vfix.push_back( thalf + TMAGIC + 1e-6 );
+        }
+        else if ( v[j] >= ( tmax - TMAGIC ) ) // Near TE upper
+        {
+            jfix[j] = vfix.size();
+            vfix.push_back( tmax - ( TMAGIC + 1e-6 ) );
+        }
+    }
+
+    vector < vector < surface_point_type > > fixptmat, fixnmat;
+    if ( !vfix.empty() )
+    {
+        m_Surface.f_pt_normal_grid( u, vfix, fixptmat, fixnmat );
+    }
+
     // resize pnts and norms
     pnts.resize( nu );
     norms.resize( nu );
@@ -1324,23 +1450,14 @@ void VspSurf::Tesselate( const vector<double> &u, const vector<double> &v, std::
             vec3d norm = nmat[i][j];
             if ( norm.mag() < 1e-6 ) // Zero normal vector
             {
-                double tmax = GetWMax();
-                double thalf = 0.5 * GetWMax();
-                if ( v[j] <= TMAGIC ) // Near TE lower
-                {
-                    norm = CompNorm( u[i], TMAGIC + 1e-6 );
-                }
-                else if ( v[j] <= thalf && v[j] >= ( thalf - TMAGIC ) ) // Near leading edge
+                if ( jfix[j] >= 0 )
                 {
-                    norm = CompNorm( u[i], thalf - ( TMAGIC + 1e-6 ) );
-                }
-                else if ( v[j] >= thalf && v[j] <= ( thalf + TMAGIC ) ) // Near leading edge
-                {
-                    norm = CompNorm( u[i], thalf + TMAGIC + 1e-6 );
-                }
-                else if ( v[j] >= ( tmax - TMAGIC ) ) // Near TE upper
-                {
-                    norm = CompNorm( u[i], tmax - ( TMAGIC + 1e-6 ) );
+                    // Same as CompNorm, which applies m_FlipNormal itself
+                    norm = fixnmat[i][ jfix[j] ];
+                    if ( m_FlipNormal )
+                    {
+                        norm = -1.0 * norm;
+                    }
                 }
                 norm.normalize();
             }
@@ -1358,6 +1475,223 @@ void VspSurf::Tesselate( const vector<double> &u, const vector<double> &v, std::
     }
 }
 
+//==== Evaluate A Grid With S Along The Split Direction, Indexed [s][t] ====//
+void VspSurf::EvalGrid( const vector<double> &s, const vector<double> &t, bool split_u, vector< vector< vec3d > > &pts, vector< vector< vec3d > > &norms ) const
+{
+    vector < vector < surface_point_type > > ptmat, nmat;
+
+    if ( split_u )
+    {
+        m_Surface.f_pt_normal_grid( s, t, ptmat, nmat );
+    }
+    else
+    {
+        m_Surface.f_pt_normal_grid( t, s, ptmat, nmat );
+    }
+
+    pts.resize( s.size() );
+    norms.resize( s.size() );
+    for ( int i = 0; i < ( int )s.size(); i++ )
+    {
+        pts[i].resize( t.size() );
+        norms[i].resize( t.size() );
+        for ( int j = 0; j < ( int )t.size(); j++ )
+        {
+            if ( split_u )
+            {
+                pts[i][j] = ptmat[i][j];
+                norms[i][j] = nmat[i][j];
+            }
+            else
+            {
+                pts[i][j] = ptmat[j][i];
+                norms[i][j] = nmat[j][i];
+            }
+        }
+    }
+}
+
+//==== Find The S Intervals That Miss Tolerance Along Any T Line ====//
+// sbad is how far each split misses, as the worst ratio to either tolerance
+void VspSurf::AdaptSplit( const vector<double> &s, const vector<double> &t, bool split_u, double tol, double cos_tol, vector<double> &snew, vector<double> &sbad ) const
+{
+    int ns = s.size();
+    int nt = t.size();
+
+    // Intervals this narrow are blunt edge bands or already at the pass limit
+    double min_span = 2.0 * TMAGIC;
+
+    vector < int > iseg;
+    vector < double > smid, slo, shi;
+    for ( int i = 0; i < ns - 1; i++ )
+    {
+        double ds = s[i + 1] - s[i];
+        if ( ds > min_span )
+        {
+            iseg.push_back( i );
+            smid.push_back( s[i] + 0.5 * ds );
+            slo.push_back( s[i] + 1e-3 * ds );
+            shi.push_back( s[i + 1] - 1e-3 * ds );
+        }
+    }
+
+    if ( iseg.empty() )
+    {
+        return;
+    }
+
+    vector< vector< vec3d > > pts, norms, midpts, midnorms, lopts, lonorms, hipts, hinorms;
+    EvalGrid( s, t, split_u, pts, norms );
+    EvalGrid( smid, t, split_u, midpts, midnorms );
+
+    // Normals just inside each end, so a crease on a grid line is not split toward forever
+    EvalGrid( slo, t, split_u, lopts, lonorms );
+    EvalGrid( shi, t, split_u, hipts, hinorms );
+
+    double angle_span = max( 1.0 - cos_tol, 1e-12 );
+
+    for ( int k = 0; k < ( int )iseg.size(); k++ )
+    {
+        int i = iseg[k];
+        double bad = 0.0;
+
+        for ( int j = 0; j < nt; j++ )
+        {
+            vec3d chordmid = 0.5 * ( pts[i][j] + pts[i + 1][j] );
+            bad = max( bad, dist( chordmid, midpts[k][j] ) / tol );
+
+            vec3d nlo = lonorms[k][j];
+            vec3d nhi = hinorms[k][j];
+            if ( nlo.mag() > 1e-6 && nhi.mag() > 1e-6 )
+            {
+                nlo.normalize();
+                nhi.normalize();
+                bad = max( bad, ( 1.0 - dot( nlo, nhi ) ) / angle_span );
+            }
+        }
+
+        if ( bad > 1.0 )
+        {
+            snew.push_back( smid[k] );
+            sbad.push_back( bad );
+        }
+    }
+}
+
+//==== Keep The Worst Splits That Fit Under ADAPT_TESS_MAX_CURVES ====//
+static void LimitAdaptSplits( int ncurve, vector<double> &snew, const vector<double> &sbad )
+{
+    int nkeep = ADAPT_TESS_MAX_CURVES - ncurve;
+    if ( nkeep >= ( int )snew.size() )
+    {
+        return;
+    }
+
+    vector < pair < double, double > > bad_s;
+    for ( int k = 0; k < ( int )snew.size(); k++ )
+    {
+        bad_s.push_back( make_pair( -sbad[k], snew[k] ) );
+    }
+    std::sort( bad_s.begin(), bad_s.end() );
+
+    snew.clear();
+    for ( int k = 0; k < nkeep; k++ )
+    {
+        snew.push_back( bad_s[k].second );
+    }
+}
+
+//==== Insert Grid Lines Where Chordal Deviation Or Normal Angle Miss Tolerance ====//
+// The grid stays a tensor product over the whole surface, so every patch
+// boundary and seam shares its points and the result is free of cracks.
+void VspSurf::AdaptTess( vector<double> &u, vector<double> &v, bool adapt_v ) const
+{
+    if ( m_AdaptChordTol <= 0 || u.size() < 2 || v.size() < 2 )
+    {
+        return;
+    }
+
+    BndBox bb;
+    GetBoundingBox( bb );
+    double cos_tol = cos( m_AdaptAngleTol * PI / 180.0 );
+
+    // A quad center misses the surface by about the sum of its U and W chordal
+    // deviations, so each direction gets half the tolerance to keep the
+    // reported Tess_Error under it
+    double tol = 0.5 * m_AdaptChordTol * bb.DiagDist();
+
+    for ( int pass = 0; pass < m_AdaptMaxPass; pass++ )
+    {
+        vector < double > unew, vnew, ubad, vbad;
+
+        AdaptSplit( u, v, true, tol, cos_tol, unew, ubad );
+        LimitAdaptSplits( u.size(), unew, ubad );
+        if ( adapt_v )
+        {
+            AdaptSplit( v, u, false, tol, cos_tol, vnew, vbad );
+            LimitAdaptSplits( v.size(), vnew, vbad );
+        }
+
+        if ( unew.empty() && vnew.empty() )
+        {
+            break;
+        }
+
+        u.insert( u.end(), unew.begin(), unew.end() );
+        std::sort( u.begin(), u.end() );
+        v.insert( v.end(), vnew.begin(), vnew.end() );
+        std::sort( v.begin(), v.end() );
+    }
+}
+
+//==== Largest Distance From A Tessellation Quad Center To The Surface ====//
+double VspSurf::CompTessError( const std::vector< vector< vec3d > > & uw_pnts ) const
+{
+    int nu = uw_pnts.size();
+    if ( nu < 2 || uw_pnts[0].size() < 2 )
+    {
+        return 0.0;
+    }
+    int nv = uw_pnts[0].size();
+
+    vector < double > u( nu ), v( nv ), umid( nu - 1 ), vmid( nv - 1 );
+    for ( int i = 0; i < nu; i++ )
+    {
+        u[i] = uw_pnts[i][0].x();
+    }
+    for ( int j = 0; j < nv; j++ )
+    {
+        v[j] = uw_pnts[0][j].y();
+    }
+    for ( int i = 0; i < nu - 1; i++ )
+    {
+        umid[i] = 0.5 * ( u[i] + u[i + 1] );
+    }
+    for ( int j = 0; j < nv - 1; j++ )
+    {
+        vmid[j] = 0.5 * ( v[j] + v[j + 1] );
+    }
+
+    vector < vector < surface_point_type > > ptmat, midmat, nmat;
+    m_Surface.f_pt_normal_grid( u, v, ptmat, nmat );
+    m_Surface.f_pt_normal_grid( umid, vmid, midmat, nmat );
+
+    double err = 0.0;
+    for ( int i = 0; i < nu - 1; i++ )
+    {
+        for ( int j = 0; j < nv - 1; j++ )
+        {
+            vec3d quadmid = 0.25 * ( vec3d( ptmat[i][j] ) + vec3d( ptmat[i + 1][j] ) + vec3d( ptmat[i + 1][j + 1] ) + vec3d( ptmat[i][j + 1] ) );
+            double d = dist( quadmid, vec3d( midmat[i][j] ) );
+            if ( d > err )
+            {
+                err = d;
+            }
+        }
+    }
+    return err;
+}
+
 void VspSurf::SplitTesselate( const vector<double> &usplit, const vector<double> &vsplit, const vector<double> &u, const vector<double> &v, std::vector< vector< vector< vec3d > > > & pnts,  std::vector< vector< vector< vec3d > > > & norms ) const
 {
     vector < int > iusplit;
@@ -38,6 +38,9 @@ typedef piecewise_surface_type::tolerance_type surface_tolerance_type;
 typedef eli::geom::curve::piecewise_cubic_spline_creator<double, 3, surface_tolerance_type> piecewise_cubic_spline_creator_type;
 typedef eli::geom::surface::connection_data<double, 3, surface_tolerance_type> rib_data_type;
 
+// Adaptive tessellation never grows either grid direction past this many curves
+#define ADAPT_TESS_MAX_CURVES 1000
+
 #include <vector>
 #include <string>
 using std::vector;
@@ -162,11 +165,20 @@ public:
     void FetchXFerSurf( const std::string &geom_id, int surf_ind, int comp_ind, vector< XferSurf > &xfersurfs, const vector < double > &usuppress = std::vector< double >(), const vector < double > &wsuppress = std::vector< double >() );
 
     void ResetUWSkip();
+
+    unsigned long long GetHash( unsigned long long hash );
     void FlagDuplicate( VspSurf *othersurf );
 
     void SetClustering( const double &le, const double &te );
     void SetRootTipClustering( const vector < double > &root, const vector < double > &tip );
 
+    // Refine the tessellation until chordal deviation (fraction of bounding box
+    // diagonal) and normal angle (deg) are met, max_pass passes run, or a
+    // direction reaches ADAPT_TESS_MAX_CURVES. A chord_tol <= 0 keeps the
+    // uniform grid.
+    void SetAdaptTess( double chord_tol, double angle_tol, int max_pass );
+    double CompTessError( const std::vector< vector< vec3d > > & uw_pnts ) const;
+
     void MakeUTess( const vector<int> &num_u, std::vector<double> &utess, const std::vector<int> & umerge ) const;
     void MakeVTess( int num_v, std::vector<double> &vtess, const int &n_cap, bool degen ) const;
 
@@ -254,6 +266,10 @@ protected:
 
     bool CheckValidPatch( const piecewise_surface_type &surf );
 
+    void AdaptTess( vector<double> &u, vector<double> &v, bool adapt_v ) const;
+    void AdaptSplit( const vector<double> &s, const vector<double> &t, bool split_u, double tol, double cos_tol, vector<double> &snew, vector<double> &sbad ) const;
+    void EvalGrid( const vector<double> &s, const vector<double> &t, bool split_u, vector< vector< vec3d > > &pts, vector< vector< vec3d > > &norms ) const;
+
     bool m_FlipNormal;
     bool m_MagicVParm;
     bool m_HalfBOR;
@@ -273,6 +289,10 @@ protected:
     vector < double > m_RootCluster;
     vector < double > m_TipCluster;
 
+    double m_AdaptChordTol;
+    double m_AdaptAngleTol;
+    int m_AdaptMaxPass;
+
 
     //==== Store Skinning Inputs =====//
     int m_SkinType;
@@ -0,0 +1,151 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// bvhbench: Time the TMesh bounding volume hierarchy queries
+//
+//    bvhbench [tess] [max_threads]
+//
+// Tessellates two overlapping pods and one off to the side, then times the
+// BVH build with 1, 2, 4 ... max_threads threads, ray casts from each tri of
+// the second pod through the first, CheckIntersect, MinDistance and Intersect.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <chrono>
+
+#include "main.h"
+#include "VSP_Geom_API.h"
+#include "Vehicle.h"
+#include "VehicleMgr.h"
+#include "TMesh.h"
+#include "ThreadPool.h"
+
+using namespace std::chrono;
+
+void vsp_exit()
+{
+    exit( 0 );
+}
+
+int main( int argc, char** argv )
+{
+    int tess = 201;
+    int max_threads = ThreadPool::GetNumHardwareThreads();
+
+    if ( argc > 1 )
+    {
+        tess = atoi( argv[1] );
+    }
+    if ( argc > 2 )
+    {
+        max_threads = atoi( argv[2] );
+    }
+
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+
+    //==== Two Overlapping Pods and One Off To The Side ====//
+    string pod_id[3];
+    for ( int g = 0 ; g < 3 ; g++ )
+    {
+        pod_id[g] = vsp::AddGeom( "POD" );
+        vsp::SetParmVal( pod_id[g], "Tess_U", "Shape", tess - 1 );
+        vsp::SetParmVal( pod_id[g], "Tess_W", "Shape", tess );
+    }
+    vsp::SetParmVal( pod_id[1], "X_Rel_Location", "XForm", 1.5 );
+    vsp::SetParmVal( pod_id[1], "Z_Rel_Location", "XForm", 0.2 );
+    vsp::SetParmVal( pod_id[2], "Z_Rel_Location", "XForm", 3.0 );
+
+    vsp::Update();
+    if ( vsp::ErrorMgr.PopErrorAndPrint( stdout ) )
+    {
+        return EXIT_FAILURE;
+    }
+
+    Vehicle* veh = VehicleMgr.GetVehicle();
+    vector< TMesh* > tmv[3];
+    for ( int g = 0 ; g < 3 ; g++ )
+    {
+        tmv[g] = veh->FindGeom( pod_id[g] )->CreateTMeshVec();
+        if ( tmv[g].size() == 0 )
+        {
+            return EXIT_FAILURE;
+        }
+    }
+    TMesh* mesh_a = tmv[0][0];
+    TMesh* mesh_b = tmv[1][0];
+    TMesh* mesh_c = tmv[2][0];
+
+    printf( "Tris              = %d\n", ( int )mesh_a->m_TVec.size() );
+
+    //==== Build ====//
+    printf( "%8s %12s %8s\n", "Threads", "Build (sec)", "Nodes" );
+    for ( int num_threads = 1 ; num_threads <= std::max( max_threads, 1 ) ; num_threads *= 2 )
+    {
+        steady_clock::time_point start = steady_clock::now();
+
+        mesh_a->m_TBox.Reset();
+        for ( int i = 0 ; i < ( int )mesh_a->m_TVec.size() ; i++ )
+        {
+            mesh_a->m_TBox.AddTri( mesh_a->m_TVec[i] );
+        }
+        mesh_a->m_TBox.Build( num_threads );
+
+        double t = duration< double >( steady_clock::now() - start ).count();
+        printf( "%8d %12.4f %8d\n", num_threads, t, mesh_a->m_TBox.GetNumNodes() );
+    }
+    mesh_b->LoadBndBox();
+    mesh_c->LoadBndBox();
+
+    //==== Ray Casts From Each Tri Of B Through A, As In DeterIntExt ====//
+    vec3d dir( 1.0, 0.000001, 0.000001 );
+    int num_rays = ( int )mesh_b->m_TVec.size();
+    steady_clock::time_point r0 = steady_clock::now();
+    for ( int i = 0 ; i < num_rays ; i++ )
+    {
+        TTri* tri = mesh_b->m_TVec[i];
+        vec3d orig = ( tri->m_N0->m_Pnt + tri->m_N1->m_Pnt + tri->m_N2->m_Pnt ) / 3.0;
+
+        vector< double > t_vec;
+        mesh_a->m_TBox.RayCast( orig, dir, t_vec );
+    }
+    double ray_time = duration< double >( steady_clock::now() - r0 ).count();
+    printf( "Ray Casts / sec   = %.0f\n", num_rays / std::max( ray_time, 1.0e-9 ) );
+
+    //==== Tri-Tri Pairs ====//
+    steady_clock::time_point c0 = steady_clock::now();
+    bool isect_ab = mesh_a->CheckIntersect( mesh_b );
+    bool isect_ac = mesh_a->CheckIntersect( mesh_c );
+    printf( "CheckIntersect    = %.4f sec ( %d %d )\n", duration< double >( steady_clock::now() - c0 ).count(),
+            ( int )isect_ab, ( int )isect_ac );
+
+    steady_clock::time_point m0 = steady_clock::now();
+    double min_dist = mesh_a->MinDistance( mesh_c, 1.0e12 );
+    printf( "MinDistance       = %.4f sec ( %g )\n", duration< double >( steady_clock::now() - m0 ).count(), min_dist );
+
+    steady_clock::time_point i0 = steady_clock::now();
+    mesh_a->Intersect( mesh_b );
+    double isect_time = duration< double >( steady_clock::now() - i0 ).count();
+
+    int num_edges = 0;
+    for ( int i = 0 ; i < ( int )mesh_a->m_TVec.size() ; i++ )
+    {
+        num_edges += ( int )mesh_a->m_TVec[i]->m_ISectEdgeVec.size();
+    }
+    printf( "Intersect         = %.4f sec ( %d edges )\n", isect_time, num_edges );
+
+    for ( int g = 0 ; g < 3 ; g++ )
+    {
+        for ( int i = 0 ; i < ( int )tmv[g].size() ; i++ )
+        {
+            delete tmv[g][i];
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
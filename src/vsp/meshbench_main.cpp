@@ -0,0 +1,83 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// meshbench: Time and measure the CFD mesh Remesh step
+//
+//    meshbench [max_edge_len] [num_threads]
+//
+// Builds a fuselage/wing/pod model, runs CFDMesh on it and prints the
+// Remesh wall time and the peak node/edge/tri pool memory.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+
+#include "main.h"
+#include "VSP_Geom_API.h"
+#include "CfdMeshMgr.h"
+
+void vsp_exit()
+{
+    exit( 0 );
+}
+
+int main( int argc, char** argv )
+{
+    double max_len = 0.1;
+    int num_threads = 1;
+
+    if ( argc > 1 )
+    {
+        max_len = atof( argv[1] );
+    }
+    if ( argc > 2 )
+    {
+        num_threads = atoi( argv[2] );
+    }
+
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+
+    //==== Build Model ====//
+    string fuse_id = vsp::AddGeom( "FUSELAGE" );
+
+    string wing_id = vsp::AddGeom( "WING", fuse_id );
+    vsp::SetParmVal( wing_id, "X_Rel_Location", "XForm", 10.0 );
+
+    string pod_id = vsp::AddGeom( "POD", wing_id );
+    vsp::SetParmVal( pod_id, "Y_Rel_Location", "XForm", 4.0 );
+    vsp::SetParmVal( pod_id, "Z_Rel_Location", "XForm", -0.5 );
+
+    vsp::Update();
+    vsp::ErrorMgr.PopErrorAndPrint( stdout );
+
+    //==== Mesh It ====//
+    vsp::SetCFDMeshVal( vsp::CFD_MAX_EDGE_LEN, max_len );
+    vsp::SetCFDMeshVal( vsp::CFD_MIN_EDGE_LEN, max_len * 0.1 );
+    vsp::SetCFDMeshVal( vsp::CFD_NUM_THREADS, num_threads );
+
+    vsp::SetComputationFileName( vsp::CFD_STL_TYPE, "meshbench.stl" );
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    vsp::ComputeCFDMesh( vsp::SET_ALL, vsp::CFD_STL_TYPE );
+
+    double total_time = std::chrono::duration< double >( std::chrono::steady_clock::now() - start ).count();
+
+    if ( vsp::ErrorMgr.PopErrorAndPrint( stdout ) )
+    {
+        return EXIT_FAILURE;
+    }
+
+    printf( "Max Edge Len      = %g\n", max_len );
+    printf( "Threads           = %d\n", num_threads );
+    printf( "CFDMesh Time      = %.3f sec\n", total_time );
+    printf( "Remesh Time       = %.3f sec\n", CfdMeshMgr.GetRemeshTime() );
+    printf( "Remesh Peak Mem   = %.1f MB\n", CfdMeshMgr.GetRemeshPeakBytes() / ( 1024.0 * 1024.0 ) );
+
+    return EXIT_SUCCESS;
+}
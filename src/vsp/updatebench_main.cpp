@@ -0,0 +1,145 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// updatebench: Time a full Vehicle update over a range of thread counts
+//
+//    updatebench [file.vsp3] [max_threads] [num_repeat]
+//
+// Reads the model, or builds one of many separate wings, pods and props
+// when no file is given, then forces every Geom to rebuild its surfaces
+// with 1, 2, 4 ... max_threads update threads.  Prints the time, speedup
+// and the largest Geom bounding box difference from the one thread run.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <chrono>
+
+#include "main.h"
+#include "VSP_Geom_API.h"
+#include "Vehicle.h"
+#include "VehicleMgr.h"
+#include "ThreadPool.h"
+
+void vsp_exit()
+{
+    exit( 0 );
+}
+
+//==== Many Separate Component Trees ====//
+void BuildModel()
+{
+    string fuse_id = vsp::AddGeom( "FUSELAGE" );
+    vsp::SetParmVal( fuse_id, "Length", "Design", 30.0 );
+
+    for ( int i = 0 ; i < 4 ; i++ )
+    {
+        string wing_id = vsp::AddGeom( "WING" );
+        vsp::SetParmVal( wing_id, "X_Rel_Location", "XForm", 10.0 + 5.0 * i );
+        vsp::SetParmVal( wing_id, "Z_Rel_Location", "XForm", 2.0 * i );
+        vsp::SetParmVal( wing_id, "Tess_W", "Shape", 41 );
+    }
+
+    for ( int i = 0 ; i < 8 ; i++ )
+    {
+        string pod_id = vsp::AddGeom( "POD" );
+        vsp::SetParmVal( pod_id, "X_Rel_Location", "XForm", 12.0 );
+        vsp::SetParmVal( pod_id, "Y_Rel_Location", "XForm", 2.0 + 1.5 * i );
+        vsp::SetParmVal( pod_id, "Z_Rel_Location", "XForm", -1.0 );
+
+        string prop_id = vsp::AddGeom( "PROP" );
+        vsp::SetParmVal( prop_id, "X_Rel_Location", "XForm", 10.0 );
+        vsp::SetParmVal( prop_id, "Y_Rel_Location", "XForm", 2.0 + 1.5 * i );
+        vsp::SetParmVal( prop_id, "Z_Rel_Location", "XForm", -1.0 );
+    }
+}
+
+int main( int argc, char** argv )
+{
+    int max_threads = ThreadPool::GetNumHardwareThreads();
+    int num_repeat = 3;
+
+    if ( argc > 2 )
+    {
+        max_threads = atoi( argv[2] );
+    }
+    if ( argc > 3 )
+    {
+        num_repeat = atoi( argv[3] );
+    }
+
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+
+    if ( argc > 1 )
+    {
+        vsp::ReadVSPFile( argv[1] );
+    }
+    else
+    {
+        BuildModel();
+    }
+
+    vsp::Update();
+    if ( vsp::ErrorMgr.PopErrorAndPrint( stdout ) )
+    {
+        return EXIT_FAILURE;
+    }
+
+    Vehicle* veh = VehicleMgr.GetVehicle();
+    vector< Geom* > geom_vec = veh->FindGeomVec( veh->GetGeomVec() );
+
+    printf( "Geoms             = %d\n", ( int )geom_vec.size() );
+    printf( "%8s %12s %10s %14s\n", "Threads", "Time (sec)", "Speedup", "Max BBox Diff" );
+
+    vector< BndBox > serial_box_vec;
+    double serial_time = 0.0;
+
+    for ( int num_threads = 1 ; num_threads <= std::max( max_threads, 1 ) ; num_threads *= 2 )
+    {
+        veh->SetUpdateThreads( num_threads );
+
+        double best_time = 0.0;
+        for ( int r = 0 ; r < num_repeat ; r++ )
+        {
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+            veh->ForceUpdate();
+
+            double t = std::chrono::duration< double >( std::chrono::steady_clock::now() - start ).count();
+            if ( r == 0 || t < best_time )
+            {
+                best_time = t;
+            }
+        }
+
+        //==== Compare Against One Thread ====//
+        double max_diff = 0.0;
+        for ( int i = 0 ; i < ( int )geom_vec.size() ; i++ )
+        {
+            BndBox box = geom_vec[i]->GetBndBox();
+            if ( num_threads == 1 )
+            {
+                serial_box_vec.push_back( box );
+            }
+            else
+            {
+                max_diff = std::max( max_diff, dist( box.GetMin(), serial_box_vec[i].GetMin() ) );
+                max_diff = std::max( max_diff, dist( box.GetMax(), serial_box_vec[i].GetMax() ) );
+            }
+        }
+
+        if ( num_threads == 1 )
+        {
+            serial_time = best_time;
+        }
+
+        printf( "%8d %12.4f %10.2f %14g\n", num_threads, best_time, serial_time / best_time, max_diff );
+    }
+
+    return EXIT_SUCCESS;
+}